@@ -36,6 +36,7 @@ const FILAMENT_LIBS: &[&str] = &[
     "ibl-lite",
     "image",
     "ktxreader",
+    "basis_transcoder", // KTX2/Basis transcoding for Ktx2Reader
     "stb",
     "dracodec",
     "meshoptimizer",
@@ -59,6 +60,8 @@ struct BuildPaths {
     lib_dir: PathBuf,
     filagui_include_dir: PathBuf,
     imgui_dir: PathBuf,
+    stb_dir: PathBuf,
+    meshoptimizer_dir: PathBuf,
 }
 
 /// Download URL for Windows release
@@ -153,6 +156,11 @@ fn resolve_paths() -> BuildPaths {
         .join("filagui")
         .join("include");
     let imgui_dir = filament_src_dir.join("third_party").join("imgui");
+    let stb_dir = filament_src_dir.join("third_party").join("stb");
+    let meshoptimizer_dir = filament_src_dir
+        .join("third_party")
+        .join("meshoptimizer")
+        .join("src");
 
     BuildPaths {
         out_dir,
@@ -163,6 +171,8 @@ fn resolve_paths() -> BuildPaths {
         lib_dir,
         filagui_include_dir,
         imgui_dir,
+        stb_dir,
+        meshoptimizer_dir,
     }
 }
 
@@ -186,6 +196,8 @@ fn compile_filament_bindings(paths: &BuildPaths, bindings_cpp: &Path) {
         .include(&paths.include_dir)
         .include(&paths.filagui_include_dir)
         .include(&paths.imgui_dir)
+        .include(&paths.stb_dir) // stb_image.h for the parallel texture provider
+        .include(&paths.meshoptimizer_dir) // meshoptimizer.h for EXT_meshopt_compression
         .flag("/std:c++20") // Filament uses designated initializers which require C++20
         .flag("/EHsc") // Exception handling
         .flag("/MD") // Dynamic CRT - must match Filament's "md" libraries
@@ -391,6 +403,35 @@ fn compile_egui_ui_material(filament_dir: &Path, out_dir: &Path) -> PathBuf {
     material_out
 }
 
+/// Stage the ubershader archive embedded for `--material-provider ubershader`.
+/// `PREVIZ_UBERARCHIVE` may point at a custom `.uberz` built with Filament's
+/// `uberz` tool; otherwise an empty file is staged and the bridge uses the
+/// default archive linked from `uberarchive`.
+fn stage_ubershader_archive(out_dir: &Path) -> PathBuf {
+    let archive_out = out_dir.join("ubershader.uberz");
+    println!("cargo:rerun-if-env-changed=PREVIZ_UBERARCHIVE");
+    match env::var_os("PREVIZ_UBERARCHIVE") {
+        Some(archive_src) => {
+            let archive_src = PathBuf::from(archive_src);
+            println!("cargo:rerun-if-changed={}", archive_src.display());
+            println!(
+                "cargo:warning=Embedding ubershader archive {}",
+                archive_src.display()
+            );
+            fs::copy(&archive_src, &archive_out).unwrap_or_else(|err| {
+                panic!(
+                    "Failed to copy ubershader archive {:?}: {}",
+                    archive_src, err
+                )
+            });
+        }
+        None => {
+            fs::write(&archive_out, []).expect("Failed to stage ubershader archive");
+        }
+    }
+    archive_out
+}
+
 /// Compile filagui materials and generate resources header/source.
 fn compile_filagui_resources(
     filament_dir: &Path,
@@ -483,6 +524,7 @@ fn emit_link_directives(paths: &BuildPaths) {
         "cargo:rustc-env=FILAMENT_BIN_DIR={}",
         paths.filament_dir.join("bin").display()
     );
+    println!("cargo:rustc-env=FILAMENT_VERSION={}", FILAMENT_VERSION);
 
     for lib in FILAMENT_LIBS {
         println!("cargo:rustc-link-lib=static={}", lib);
@@ -648,6 +690,12 @@ fn main() {
         egui_ui_out.display()
     );
 
+    let ubershader_archive_out = stage_ubershader_archive(&paths.out_dir);
+    println!(
+        "cargo:warning=Ubershader archive staged at {}",
+        ubershader_archive_out.display()
+    );
+
     let (filagui_generation_root, filagui_resource_dir) =
         compile_filagui_resources(&paths.filament_dir, &paths.filament_src_dir, &paths.out_dir);
     compile_filagui_bindings(&paths, &filagui_generation_root, &filagui_resource_dir);
@@ -4,6 +4,7 @@
 
 #include <cstdio>
 #include <filament/Engine.h>
+#include <filament/Fence.h>
 #include <filament/Renderer.h>
 #include <filament/Scene.h>
 #include <filament/View.h>
@@ -35,21 +36,37 @@
 #include <gltfio/MaterialProvider.h>
 #include <gltfio/ResourceLoader.h>
 #include <gltfio/TextureProvider.h>
+#include <gltfio/materials/uberarchive.h>
 #include <utils/EntityManager.h>
 #include <backend/DriverEnums.h>
 #include <backend/PixelBufferDescriptor.h>
+#include <backend/Platform.h>
 #include <filament/RenderTarget.h>
 #include <image/Ktx1Bundle.h>
 #include <ktxreader/Ktx1Reader.h>
+#include <ktxreader/Ktx2Reader.h>
 #include <fstream>
 #include <vector>
 #include <atomic>
 #include <algorithm>
+#include <string>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <stb_image.h>
+#include <meshoptimizer.h>
 
 using namespace filament;
 using namespace utils;
 using namespace filament::gltfio;
 
+// Release callback for caller-owned upload memory. Invoked by Filament once the
+// driver no longer reads `buffer`; `user` is passed through unchanged.
+typedef void (*filament_buffer_release_fn)(void* buffer, size_t size, void* user);
+
 static bool read_file_bytes(const char* path, std::vector<uint8_t>& out) {
     if (!path || !path[0]) {
         return false;
@@ -81,6 +98,68 @@ Engine* filament_engine_create(backend::Backend backend) {
     return Engine::create(backend);
 }
 
+// Engine::Config sizing. Zero fields keep Filament's defaults; Filament clamps
+// the rest to valid minimums at creation.
+typedef struct {
+    uint32_t command_buffer_size_mb;
+    uint32_t per_render_pass_arena_size_mb;
+    uint32_t driver_handle_arena_size_mb;
+    uint32_t min_command_buffer_size_mb;
+    uint32_t per_frame_commands_size_mb;
+    uint32_t job_system_thread_count;
+    uint32_t resource_allocator_cache_size_mb;
+    uint32_t resource_allocator_cache_max_age;
+} EngineConfigC;
+
+Engine* filament_engine_create_with_config(backend::Backend backend, const EngineConfigC* config) {
+    Engine::Config engine_config;
+    if (config) {
+        if (config->command_buffer_size_mb) {
+            engine_config.commandBufferSizeMB = config->command_buffer_size_mb;
+        }
+        if (config->per_render_pass_arena_size_mb) {
+            engine_config.perRenderPassArenaSizeMB = config->per_render_pass_arena_size_mb;
+        }
+        if (config->driver_handle_arena_size_mb) {
+            engine_config.driverHandleArenaSizeMB = config->driver_handle_arena_size_mb;
+        }
+        if (config->min_command_buffer_size_mb) {
+            engine_config.minCommandBufferSizeMB = config->min_command_buffer_size_mb;
+        }
+        if (config->per_frame_commands_size_mb) {
+            engine_config.perFrameCommandsSizeMB = config->per_frame_commands_size_mb;
+        }
+        if (config->job_system_thread_count) {
+            engine_config.jobSystemThreadCount = config->job_system_thread_count;
+        }
+        if (config->resource_allocator_cache_size_mb) {
+            engine_config.resourceAllocatorCacheSizeMB = config->resource_allocator_cache_size_mb;
+        }
+        if (config->resource_allocator_cache_max_age) {
+            engine_config.resourceAllocatorCacheMaxAge = static_cast<uint8_t>(
+                std::min<uint32_t>(255u, config->resource_allocator_cache_max_age));
+        }
+    }
+    return Engine::Builder()
+        .backend(backend)
+        .config(&engine_config)
+        .build();
+}
+
+// Effective configuration after Filament's validation.
+void filament_engine_get_config(const Engine* engine, EngineConfigC* out_config) {
+    if (!engine || !out_config) return;
+    const Engine::Config& config = engine->getConfig();
+    out_config->command_buffer_size_mb = config.commandBufferSizeMB;
+    out_config->per_render_pass_arena_size_mb = config.perRenderPassArenaSizeMB;
+    out_config->driver_handle_arena_size_mb = config.driverHandleArenaSizeMB;
+    out_config->min_command_buffer_size_mb = config.minCommandBufferSizeMB;
+    out_config->per_frame_commands_size_mb = config.perFrameCommandsSizeMB;
+    out_config->job_system_thread_count = config.jobSystemThreadCount;
+    out_config->resource_allocator_cache_size_mb = config.resourceAllocatorCacheSizeMB;
+    out_config->resource_allocator_cache_max_age = config.resourceAllocatorCacheMaxAge;
+}
+
 void filament_engine_destroy(Engine** engine) {
     Engine::destroy(engine);
 }
@@ -159,6 +238,194 @@ void filament_engine_flush_and_wait(Engine* engine) {
     engine->flushAndWait();
 }
 
+// Kick queued commands to the backend without waiting for them.
+void filament_engine_flush(Engine* engine) {
+    if (!engine) return;
+    engine->flush();
+}
+
+// Dispatch pending user callbacks (buffer releases, readback completions)
+// without waiting on the GPU.
+void filament_engine_pump_message_queues(Engine* engine) {
+    if (!engine) return;
+    engine->pumpMessageQueues();
+}
+
+// ============================================================================
+// Fence
+// ============================================================================
+//
+// A fence signals once the GPU has finished every command issued before it was
+// created. Used to release resources without a flushAndWait() drain.
+
+Fence* filament_engine_create_fence(Engine* engine) {
+    if (!engine) return nullptr;
+    return engine->createFence();
+}
+
+void filament_engine_destroy_fence(Engine* engine, Fence* fence) {
+    if (!engine || !fence) return;
+    engine->destroy(fence);
+}
+
+// Non-blocking status: 0 signaled, 1 not yet, -1 error.
+int32_t filament_fence_poll(Fence* fence) {
+    if (!fence) return -1;
+    return static_cast<int32_t>(fence->wait(Fence::Mode::DONT_FLUSH, 0));
+}
+
+// ============================================================================
+// Program binary cache
+// ============================================================================
+//
+// Persists compiled backend programs through Platform's blob callbacks so that
+// materials generated on earlier runs (including gltfio JIT materials) skip
+// shader compilation. Filament's blob key already hashes the material source
+// and variant; each entry is one file named after an FNV-1a hash of that key,
+// storing the key itself to reject collisions.
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stores;
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+} ProgramCacheStatsC;
+
+struct ProgramBlobCache {
+    std::string directory;
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> stores{0};
+    std::atomic<uint64_t> bytes_read{0};
+    std::atomic<uint64_t> bytes_written{0};
+};
+
+// One engine per process; the callbacks may run on the driver thread until
+// the engine is destroyed, so the cache state is never freed.
+static ProgramBlobCache g_program_cache;
+
+static std::string program_cache_entry_path(const void* key, size_t key_size) {
+    uint64_t hash = 1469598103934665603ull;
+    const auto* bytes = static_cast<const uint8_t*>(key);
+    for (size_t i = 0; i < key_size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.blob", static_cast<unsigned long long>(hash));
+    return g_program_cache.directory + "/" + name;
+}
+
+static void program_cache_insert(
+    const void* key,
+    size_t key_size,
+    const void* value,
+    size_t value_size
+) {
+    const std::string path = program_cache_entry_path(key, key_size);
+    const std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) return;
+        const uint64_t stored_key_size = key_size;
+        file.write(reinterpret_cast<const char*>(&stored_key_size), sizeof(stored_key_size));
+        file.write(static_cast<const char*>(key), static_cast<std::streamsize>(key_size));
+        file.write(static_cast<const char*>(value), static_cast<std::streamsize>(value_size));
+        if (!file) return;
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmp_path.c_str(), path.c_str()) == 0) {
+        g_program_cache.stores++;
+        g_program_cache.bytes_written += value_size;
+    }
+}
+
+// Opens the entry for `key` and checks its stored key, leaving `file`
+// positioned at the value. Only the header is read, so size queries stay
+// cheap however large the program is.
+static bool program_cache_open_entry(
+    const void* key,
+    size_t key_size,
+    std::ifstream& file,
+    size_t& value_size
+) {
+    file.open(program_cache_entry_path(key, key_size), std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    const std::streamoff file_size = file.tellg();
+    uint64_t stored_key_size = 0;
+    const std::streamoff header_size =
+            static_cast<std::streamoff>(sizeof(stored_key_size) + key_size);
+    if (file_size < header_size) return false;
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(&stored_key_size), sizeof(stored_key_size));
+    if (!file || stored_key_size != key_size) return false;
+    std::vector<char> stored_key(key_size);
+    file.read(stored_key.data(), static_cast<std::streamsize>(key_size));
+    if (!file || std::memcmp(stored_key.data(), key, key_size) != 0) return false;
+    value_size = static_cast<size_t>(file_size - header_size);
+    return true;
+}
+
+// Called with value == nullptr to query the size, then again to copy. Filament
+// skips the copy when the size query returns 0, so a missing entry is counted
+// on the query and everything else on the copy; each lookup counts once.
+static size_t program_cache_retrieve(
+    const void* key,
+    size_t key_size,
+    void* value,
+    size_t value_size
+) {
+    std::ifstream file;
+    size_t stored_value_size = 0;
+    const bool found = program_cache_open_entry(key, key_size, file, stored_value_size);
+    if (!found || stored_value_size == 0) {
+        g_program_cache.misses++;
+        return 0;
+    }
+    if (!value) {
+        return stored_value_size;
+    }
+    const size_t copied = std::min(value_size, stored_value_size);
+    file.read(static_cast<char*>(value), static_cast<std::streamsize>(copied));
+    if (!file) {
+        g_program_cache.misses++;
+        return 0;
+    }
+    g_program_cache.hits++;
+    g_program_cache.bytes_read += copied;
+    return copied;
+}
+
+// Must be called before any material is built. `directory` must exist.
+bool filament_engine_enable_program_cache(Engine* engine, const char* directory) {
+    if (!engine || !directory || !directory[0]) {
+        return false;
+    }
+    backend::Platform* platform = engine->getPlatform();
+    if (!platform) {
+        return false;
+    }
+    g_program_cache.directory = directory;
+    platform->setBlobFunc(
+        [](const void* key, size_t key_size, const void* value, size_t value_size) {
+            program_cache_insert(key, key_size, value, value_size);
+        },
+        [](const void* key, size_t key_size, void* value, size_t value_size) -> size_t {
+            return program_cache_retrieve(key, key_size, value, value_size);
+        });
+    return true;
+}
+
+void filament_program_cache_get_stats(ProgramCacheStatsC* out_stats) {
+    if (!out_stats) return;
+    out_stats->hits = g_program_cache.hits.load();
+    out_stats->misses = g_program_cache.misses.load();
+    out_stats->stores = g_program_cache.stores.load();
+    out_stats->bytes_read = g_program_cache.bytes_read.load();
+    out_stats->bytes_written = g_program_cache.bytes_written.load();
+}
+
 // ============================================================================
 // Renderer
 // ============================================================================
@@ -208,6 +475,120 @@ void filament_view_set_visible_layers(View* view, uint8_t select, uint8_t values
     view->setVisibleLayers(select, values);
 }
 
+// ============================================================================
+// View picking query
+// ============================================================================
+//
+// Wraps View::pick(): the renderable, depth and fragment coordinates come from
+// the beauty pass's structure buffer, so no extra view is rendered. The query
+// slot is polled like AsyncReadback and is reference counted while in flight.
+
+typedef struct {
+    int32_t entity;
+    float depth;
+    float frag_x;
+    float frag_y;
+    float frag_z;
+    float world_x;
+    float world_y;
+    float world_z;
+} ViewPickResult;
+
+struct ViewPickQuery {
+    ViewPickResult result{};
+    math::mat4 inverse_view_projection;
+    uint32_t viewport_width = 1;
+    uint32_t viewport_height = 1;
+    std::atomic<bool> in_flight{false};
+    std::atomic<bool> ready{false};
+    // One reference for the owner plus one while a query is in flight.
+    std::atomic<uint32_t> refs{1};
+};
+
+static void view_pick_query_release(ViewPickQuery* query) {
+    if (query->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete query;
+    }
+}
+
+ViewPickQuery* filament_view_pick_query_create() {
+    return new ViewPickQuery();
+}
+
+void filament_view_pick_query_destroy(ViewPickQuery* query) {
+    if (!query) return;
+    view_pick_query_release(query);
+}
+
+bool filament_view_pick_query_is_busy(const ViewPickQuery* query) {
+    if (!query) return false;
+    return query->in_flight.load(std::memory_order_acquire)
+        || query->ready.load(std::memory_order_acquire);
+}
+
+// Copy out a completed query and free the slot. Returns false while pending.
+bool filament_view_pick_query_poll(ViewPickQuery* query, ViewPickResult* out_result) {
+    if (!query || !query->ready.load(std::memory_order_acquire)) {
+        return false;
+    }
+    if (out_result) {
+        *out_result = query->result;
+    }
+    query->ready.store(false, std::memory_order_release);
+    return true;
+}
+
+// Issue a pick at window coordinates (bottom-left origin). Coordinates outside
+// the view's viewport are rejected. The result is delivered after the view is
+// next rendered.
+bool filament_view_pick(View* view, uint32_t window_x, uint32_t window_y, ViewPickQuery* query) {
+    if (!view || !query || filament_view_pick_query_is_busy(query)) {
+        return false;
+    }
+    const Viewport& viewport = view->getViewport();
+    const int64_t x = static_cast<int64_t>(window_x) - viewport.left;
+    const int64_t y = static_cast<int64_t>(window_y) - viewport.bottom;
+    if (x < 0 || y < 0 || x >= viewport.width || y >= viewport.height) {
+        return false;
+    }
+    // Capture the camera used for this frame so the world position matches the
+    // depth that will be returned.
+    const Camera& camera = view->getCamera();
+    query->inverse_view_projection =
+        math::inverse(camera.getProjectionMatrix() * camera.getViewMatrix());
+    query->viewport_width = std::max(viewport.width, 1u);
+    query->viewport_height = std::max(viewport.height, 1u);
+    query->in_flight.store(true, std::memory_order_release);
+    query->refs.fetch_add(1, std::memory_order_acq_rel);
+    view->pick(static_cast<uint32_t>(x), static_cast<uint32_t>(y),
+        [query](View::PickingQueryResult const& picked) {
+            ViewPickResult out{};
+            out.entity = picked.renderable.isNull() ? 0 : static_cast<int32_t>(Entity::smuggle(picked.renderable));
+            out.depth = picked.depth;
+            out.frag_x = picked.fragCoords.x;
+            out.frag_y = picked.fragCoords.y;
+            out.frag_z = picked.fragCoords.z;
+            // Filament stores reversed-Z depth (1 at the near plane, 0 at far);
+            // map back to GL clip-space z before unprojecting.
+            const math::double4 ndc(
+                2.0 * picked.fragCoords.x / query->viewport_width - 1.0,
+                2.0 * picked.fragCoords.y / query->viewport_height - 1.0,
+                1.0 - 2.0 * static_cast<double>(picked.depth),
+                1.0);
+            const math::double4 world = query->inverse_view_projection * ndc;
+            if (world.w != 0.0) {
+                out.world_x = static_cast<float>(world.x / world.w);
+                out.world_y = static_cast<float>(world.y / world.w);
+                out.world_z = static_cast<float>(world.z / world.w);
+            }
+            query->result = out;
+            query->ready.store(true, std::memory_order_release);
+            query->in_flight.store(false, std::memory_order_release);
+            view_pick_query_release(query);
+        });
+    return true;
+}
+
 // ============================================================================
 // Scene
 // ============================================================================
@@ -230,6 +611,101 @@ void filament_scene_set_skybox(Scene* scene, Skybox* skybox) {
     scene->setSkybox(skybox);
 }
 
+// KTX2 files open with the identifier «KTX 20»\r\n\x1A\n.
+static bool is_ktx2(const uint8_t* data, size_t size) {
+    static const uint8_t identifier[12] = {
+        0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A
+    };
+    return size >= sizeof(identifier)
+        && std::memcmp(data, identifier, sizeof(identifier)) == 0;
+}
+
+// Whether a KTX2 file's basic data format descriptor declares sRGB transfer.
+static bool ktx2_is_srgb(const uint8_t* data, size_t size) {
+    // The identifier and nine uint32 header fields precede dfdByteOffset.
+    uint32_t dfd_offset = 0;
+    if (size < 52) return true;
+    std::memcpy(&dfd_offset, data + 48, sizeof(dfd_offset));
+    // dfdTotalSize and two block header words precede colorModel,
+    // colorPrimaries and transferFunction.
+    const size_t transfer = size_t(dfd_offset) + 4 + 8 + 2;
+    if (transfer >= size) return true;
+    return data[transfer] == 2; // KHR_DF_TRANSFER_SRGB
+}
+
+// Whether a Basis KTX2 file carries alpha, from the channel ids in its basic
+// data format descriptor. basisu leaves the alpha out when every source alpha
+// is 1.0, so opaque textures report false. Other layouts report true.
+static bool ktx2_has_alpha(const uint8_t* data, size_t size) {
+    uint32_t dfd_offset = 0;
+    if (size < 52) return true;
+    std::memcpy(&dfd_offset, data + 48, sizeof(dfd_offset));
+    // dfdTotalSize precedes the block; its size is the second uint16 of
+    // word 1, and 16-byte samples follow the 24-byte block header.
+    const size_t block = size_t(dfd_offset) + 4;
+    if (block + 24 > size) return true;
+    uint16_t block_size = 0;
+    std::memcpy(&block_size, data + block + 6, sizeof(block_size));
+    if (block_size < 24 || block + block_size > size) return true;
+    const uint8_t color_model = data[block + 8];
+    const size_t sample_count = (block_size - 24) / 16;
+    for (size_t i = 0; i < sample_count; i++) {
+        const uint8_t channel = data[block + 24 + i * 16 + 3] & 0x0F;
+        switch (color_model) {
+            case 163: // KHR_DF_MODEL_ETC1S: a second AAA slice holds alpha.
+                if (channel == 15) return true;
+                break;
+            case 166: // KHR_DF_MODEL_UASTC: RGBA or RRRG.
+                if (channel == 3 || channel == 5) return true;
+                break;
+            default:
+                return true;
+        }
+    }
+    return false;
+}
+
+// Transcode a Basis (ETC1S or UASTC) KTX2 to the first block format the
+// backend samples, in order BC, ETC2, ASTC 4x4, then uncompressed RGBA8.
+// Opaque textures take BC1 and ETC2 RGB, half the size of BC3 and ETC2 EAC.
+static void request_ktx2_formats(ktxreader::Ktx2Reader& reader, bool srgb, bool alpha) {
+    using InternalFormat = Texture::InternalFormat;
+    if (srgb) {
+        reader.requestFormat(alpha ? InternalFormat::DXT5_SRGBA : InternalFormat::DXT1_SRGB);
+        reader.requestFormat(alpha ? InternalFormat::ETC2_EAC_SRGBA8 : InternalFormat::ETC2_SRGB8);
+        reader.requestFormat(InternalFormat::SRGB8_ALPHA8_ASTC_4x4);
+        reader.requestFormat(InternalFormat::SRGB8_A8);
+    } else {
+        reader.requestFormat(alpha ? InternalFormat::DXT5_RGBA : InternalFormat::DXT1_RGB);
+        reader.requestFormat(alpha ? InternalFormat::ETC2_EAC_RGBA8 : InternalFormat::ETC2_RGB8);
+        reader.requestFormat(InternalFormat::RGBA_ASTC_4x4);
+        reader.requestFormat(InternalFormat::RGBA8);
+    }
+}
+
+static Texture* create_texture_from_ktx2(Engine* engine, const uint8_t* data, size_t size) {
+    using TransferFunction = ktxreader::Ktx2Reader::TransferFunction;
+    const bool srgb = ktx2_is_srgb(data, size);
+    ktxreader::Ktx2Reader reader(*engine, true);
+    request_ktx2_formats(reader, srgb, ktx2_has_alpha(data, size));
+    return reader.load(data, size, srgb ? TransferFunction::sRGB : TransferFunction::LINEAR);
+}
+
+// The same transcode split across threads with Ktx2Reader's async path: the
+// texture is created on the engine thread, transcoded on any thread, then
+// uploaded back on the engine thread. Owns a copy of the file, which the
+// transcoder reads from until it is done.
+struct Ktx2Transcode {
+    Ktx2Transcode(Engine& engine, const uint8_t* bytes, size_t size)
+        : data(bytes, bytes + size), reader(engine, true) {}
+
+    std::vector<uint8_t> data;
+    ktxreader::Ktx2Reader reader;
+    ktxreader::Ktx2Reader::Async* async = nullptr;
+    bool transcoded = false;
+    bool uploaded = false;
+};
+
 // ============================================================================
 // Environment
 // ============================================================================
@@ -326,6 +802,13 @@ void filament_camera_look_at(Camera* camera, float eye_x, float eye_y, float eye
     camera->lookAt({eye_x, eye_y, eye_z}, {center_x, center_y, center_z}, {up_x, up_y, up_z});
 }
 
+// Column-major projection * view matrix (16 doubles).
+void filament_camera_get_view_projection(Camera* camera, double* out_matrix4x4) {
+    if (!camera || !out_matrix4x4) return;
+    const math::mat4 view_projection = camera->getProjectionMatrix() * camera->getViewMatrix();
+    memcpy(out_matrix4x4, &view_projection[0][0], sizeof(double) * 16);
+}
+
 // ============================================================================
 // Entity Manager
 // ============================================================================
@@ -382,6 +865,83 @@ MaterialInstance* filament_material_create_instance(Material* material) {
     return material->createInstance();
 }
 
+// Ask the backend to build the programs for `variants` (a UserVariantFilterMask)
+// ahead of the first draw. Returns immediately; compilation runs on the
+// backend's compiler threads where supported.
+void filament_material_compile(Material* material, uint32_t variants, bool high_priority) {
+    if (!material) return;
+    material->compile(
+        high_priority ? backend::CompilerPriorityQueue::HIGH : backend::CompilerPriorityQueue::LOW,
+        static_cast<UserVariantFilterMask>(variants));
+}
+
+// ============================================================================
+// Material warm-up
+// ============================================================================
+
+// A batch of Material::compile() requests. Completion callbacks are delivered
+// on the main thread while the engine pumps its message queues.
+struct MaterialWarmup {
+    std::vector<const Material*> materials;
+    std::atomic<uint32_t> pending{0};
+    // One reference for the owner plus one per compile in flight.
+    std::atomic<uint32_t> refs{1};
+};
+
+static void material_warmup_release(MaterialWarmup* warmup) {
+    if (warmup->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete warmup;
+    }
+}
+
+MaterialWarmup* filament_material_warmup_create() {
+    return new MaterialWarmup();
+}
+
+void filament_material_warmup_destroy(MaterialWarmup* warmup) {
+    if (!warmup) return;
+    material_warmup_release(warmup);
+}
+
+// Queue `material` once per batch. Returns false if it was already queued.
+bool filament_material_warmup_add(MaterialWarmup* warmup, Material* material, uint32_t variants) {
+    if (!warmup || !material) return false;
+    if (std::find(warmup->materials.begin(), warmup->materials.end(), material)
+            != warmup->materials.end()) {
+        return false;
+    }
+    warmup->materials.push_back(material);
+    warmup->pending.fetch_add(1, std::memory_order_acq_rel);
+    warmup->refs.fetch_add(1, std::memory_order_acq_rel);
+    material->compile(backend::CompilerPriorityQueue::LOW,
+        static_cast<UserVariantFilterMask>(variants), nullptr,
+        [warmup](Material*) {
+            warmup->pending.fetch_sub(1, std::memory_order_acq_rel);
+            material_warmup_release(warmup);
+        });
+    return true;
+}
+
+bool filament_material_warmup_add_instance(
+    MaterialWarmup* warmup,
+    MaterialInstance* instance,
+    uint32_t variants
+) {
+    if (!instance) return false;
+    return filament_material_warmup_add(
+        warmup, const_cast<Material*>(instance->getMaterial()), variants);
+}
+
+uint32_t filament_material_warmup_get_count(const MaterialWarmup* warmup) {
+    if (!warmup) return 0;
+    return static_cast<uint32_t>(warmup->materials.size());
+}
+
+uint32_t filament_material_warmup_get_pending(const MaterialWarmup* warmup) {
+    if (!warmup) return 0;
+    return warmup->pending.load(std::memory_order_acquire);
+}
+
 void filament_engine_destroy_material_instance(
     Engine* engine,
     MaterialInstance* instance
@@ -508,28 +1068,32 @@ bool filament_material_instance_get_float4(
     return true;
 }
 
-bool filament_material_instance_set_texture_from_ktx(
+// Same as filament_material_instance_set_texture_from_ktx for a KTX1/KTX2
+// file already in memory (read ahead on a loader thread). `data` is copied.
+bool filament_material_instance_set_texture_from_ktx_bytes(
     Engine* engine,
     MaterialInstance* instance,
     const char* name,
-    const char* ktx_path,
+    const uint8_t* data,
+    size_t size,
     bool wrap_repeat_u,
     bool wrap_repeat_v,
     Texture** out_texture
 ) {
-    if (!engine || !instance || !name || !ktx_path || !out_texture) {
+    if (!engine || !instance || !name || !data || size == 0 || !out_texture) {
         return false;
     }
     Material const* material = instance->getMaterial();
     if (!material || !material->hasParameter(name)) {
         return false;
     }
-    std::vector<uint8_t> bytes;
-    if (!read_file_bytes(ktx_path, bytes)) {
-        return false;
+    Texture* texture = nullptr;
+    if (is_ktx2(data, size)) {
+        texture = create_texture_from_ktx2(engine, data, size);
+    } else {
+        auto* bundle = new image::Ktx1Bundle(data, (uint32_t)size);
+        texture = ktxreader::Ktx1Reader::createTexture(engine, bundle, false);
     }
-    auto* bundle = new image::Ktx1Bundle(bytes.data(), (uint32_t)bytes.size());
-    Texture* texture = ktxreader::Ktx1Reader::createTexture(engine, bundle, false);
     if (!texture) {
         return false;
     }
@@ -545,6 +1109,94 @@ bool filament_material_instance_set_texture_from_ktx(
     return true;
 }
 
+// Start transcoding a Basis KTX2 file; returns null for anything else.
+Ktx2Transcode* filament_ktx2_transcode_create(Engine* engine, const uint8_t* data, size_t size) {
+    using TransferFunction = ktxreader::Ktx2Reader::TransferFunction;
+    if (!engine || !data || !is_ktx2(data, size)) return nullptr;
+    auto* transcode = new Ktx2Transcode(*engine, data, size);
+    const bool srgb = ktx2_is_srgb(data, size);
+    request_ktx2_formats(transcode->reader, srgb, ktx2_has_alpha(data, size));
+    transcode->async = transcode->reader.asyncCreate(transcode->data.data(),
+        transcode->data.size(), srgb ? TransferFunction::sRGB : TransferFunction::LINEAR);
+    if (!transcode->async) {
+        delete transcode;
+        return nullptr;
+    }
+    return transcode;
+}
+
+// Thread safe across distinct transcodes; does not touch the engine.
+bool filament_ktx2_transcode_run(Ktx2Transcode* transcode) {
+    if (!transcode || !transcode->async) return false;
+    transcode->transcoded = transcode->async->doTranscoding()
+        == ktxreader::Ktx2Reader::Result::SUCCESS;
+    return transcode->transcoded;
+}
+
+// Upload a finished transcode (once) and bind its texture like
+// filament_material_instance_set_texture_from_ktx_bytes. Several bindings may
+// share one transcode; the texture outlives it.
+bool filament_material_instance_set_texture_from_ktx2_transcode(
+    MaterialInstance* instance,
+    const char* name,
+    Ktx2Transcode* transcode,
+    bool wrap_repeat_u,
+    bool wrap_repeat_v,
+    Texture** out_texture
+) {
+    if (!instance || !name || !transcode || !transcode->transcoded || !out_texture) {
+        return false;
+    }
+    Material const* material = instance->getMaterial();
+    if (!material || !material->hasParameter(name)) {
+        return false;
+    }
+    if (!transcode->uploaded) {
+        transcode->async->uploadImages();
+        transcode->uploaded = true;
+    }
+    Texture* texture = transcode->async->getTexture();
+    TextureSampler sampler;
+    sampler.setWrapModeS(
+        wrap_repeat_u ? TextureSampler::WrapMode::REPEAT : TextureSampler::WrapMode::CLAMP_TO_EDGE
+    );
+    sampler.setWrapModeT(
+        wrap_repeat_v ? TextureSampler::WrapMode::REPEAT : TextureSampler::WrapMode::CLAMP_TO_EDGE
+    );
+    instance->setParameter(name, texture, sampler);
+    *out_texture = texture;
+    return true;
+}
+
+// Destroys the texture too unless it was uploaded for a binding.
+void filament_ktx2_transcode_destroy(Engine* engine, Ktx2Transcode* transcode) {
+    if (!engine || !transcode) return;
+    Texture* texture = transcode->async->getTexture();
+    transcode->reader.asyncDestroy(&transcode->async);
+    if (!transcode->uploaded && texture) {
+        engine->destroy(texture);
+    }
+    delete transcode;
+}
+
+bool filament_material_instance_set_texture_from_ktx(
+    Engine* engine,
+    MaterialInstance* instance,
+    const char* name,
+    const char* ktx_path,
+    bool wrap_repeat_u,
+    bool wrap_repeat_v,
+    Texture** out_texture
+) {
+    std::vector<uint8_t> bytes;
+    if (!ktx_path || !read_file_bytes(ktx_path, bytes)) {
+        return false;
+    }
+    return filament_material_instance_set_texture_from_ktx_bytes(
+        engine, instance, name, bytes.data(), bytes.size(),
+        wrap_repeat_u, wrap_repeat_v, out_texture);
+}
+
 bool filament_material_instance_set_texture(
     MaterialInstance* instance,
     const char* name,
@@ -634,6 +1286,25 @@ void filament_vertex_buffer_set_buffer_at(VertexBuffer* vb, Engine* engine, uint
     vb->setBufferAt(*engine, buffer_index, std::move(desc), dest_offset);
 }
 
+// Zero-copy variant: Filament reads `data` in place and calls `release` when done.
+void filament_vertex_buffer_set_buffer_at_owned(
+    VertexBuffer* vb,
+    Engine* engine,
+    uint8_t buffer_index,
+    void* data,
+    size_t size,
+    uint32_t dest_offset,
+    filament_buffer_release_fn release,
+    void* user
+) {
+    if (!vb || !engine || !data) {
+        if (release) release(data, size, user);
+        return;
+    }
+    backend::BufferDescriptor desc(data, size, release, user);
+    vb->setBufferAt(*engine, buffer_index, std::move(desc), dest_offset);
+}
+
 // ============================================================================
 // Index Buffer
 // ============================================================================
@@ -676,6 +1347,170 @@ void filament_index_buffer_set_buffer(IndexBuffer* ib, Engine* engine, const voi
     ib->setBuffer(*engine, std::move(desc), dest_offset);
 }
 
+// Zero-copy variant: Filament reads `data` in place and calls `release` when done.
+void filament_index_buffer_set_buffer_owned(
+    IndexBuffer* ib,
+    Engine* engine,
+    void* data,
+    size_t size,
+    uint32_t dest_offset,
+    filament_buffer_release_fn release,
+    void* user
+) {
+    if (!ib || !engine || !data) {
+        if (release) release(data, size, user);
+        return;
+    }
+    backend::BufferDescriptor desc(data, size, release, user);
+    ib->setBuffer(*engine, std::move(desc), dest_offset);
+}
+
+// ============================================================================
+// Staging ring for dynamic geometry uploads
+// ============================================================================
+//
+// N frames of preallocated upload memory. Uploads copy into the current frame's
+// slot and the slot is reused once Filament has released every upload made from
+// it. Uploads that do not fit (or land while no slot is free) fall back to the
+// malloc path and are counted as overflows.
+
+typedef struct {
+    uint32_t frame_count;
+    uint32_t active_frame;
+    uint64_t bytes_per_frame;
+    uint64_t frames_advanced;
+    uint64_t last_frame_bytes;
+    uint64_t peak_frame_bytes;
+    uint64_t total_bytes;
+    uint64_t stalls;
+    uint64_t overflow_uploads;
+} StagingRingStats;
+
+struct StagingRing;
+
+struct StagingRingFrame {
+    StagingRing* ring = nullptr;
+    size_t base = 0;
+    size_t used = 0;
+    std::atomic<uint32_t> pending{0};
+};
+
+struct StagingRing {
+    Engine* engine = nullptr;
+    size_t bytes_per_frame = 0;
+    std::vector<uint8_t> storage;
+    std::vector<StagingRingFrame> frames;
+    // Slot taking uploads this frame. While `accepting` is false the slot is
+    // still owned by Filament and is retried on the next advance.
+    size_t current = 0;
+    bool accepting = true;
+    uint64_t frame_bytes = 0;
+    StagingRingStats stats{};
+    // One reference for the owner plus one per in-flight upload.
+    std::atomic<uint32_t> refs{1};
+};
+
+static void staging_ring_release(void*, size_t, void* user) {
+    auto* frame = static_cast<StagingRingFrame*>(user);
+    StagingRing* ring = frame->ring;
+    frame->pending.fetch_sub(1, std::memory_order_acq_rel);
+    if (ring->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete ring;
+    }
+}
+
+StagingRing* filament_staging_ring_create(Engine* engine, uint32_t frame_count, size_t bytes_per_frame) {
+    if (!engine || frame_count == 0 || bytes_per_frame == 0) {
+        return nullptr;
+    }
+    auto* ring = new StagingRing();
+    ring->engine = engine;
+    ring->bytes_per_frame = (bytes_per_frame + 15) & ~size_t(15);
+    ring->storage.resize(ring->bytes_per_frame * frame_count);
+    ring->frames = std::vector<StagingRingFrame>(frame_count);
+    for (uint32_t i = 0; i < frame_count; ++i) {
+        ring->frames[i].ring = ring;
+        ring->frames[i].base = ring->bytes_per_frame * i;
+    }
+    ring->stats.frame_count = frame_count;
+    ring->stats.bytes_per_frame = ring->bytes_per_frame;
+    return ring;
+}
+
+// Safe to call while uploads are in flight: the last release callback frees
+// the ring instead.
+void filament_staging_ring_destroy(StagingRing* ring) {
+    if (!ring) return;
+    if (ring->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete ring;
+    }
+}
+
+// Close the current frame and move to the next slot. If that slot is still in
+// flight after pumping Filament's callback queue, the frame is a stall and its
+// uploads take the malloc path.
+void filament_staging_ring_advance_frame(StagingRing* ring) {
+    if (!ring) return;
+    ring->stats.last_frame_bytes = ring->frame_bytes;
+    ring->stats.peak_frame_bytes = std::max(ring->stats.peak_frame_bytes, ring->frame_bytes);
+    ring->stats.frames_advanced++;
+    ring->frame_bytes = 0;
+
+    const size_t next = ring->accepting ? (ring->current + 1) % ring->frames.size() : ring->current;
+    StagingRingFrame& frame = ring->frames[next];
+    if (frame.pending.load(std::memory_order_acquire) != 0) {
+        ring->engine->pumpMessageQueues();
+    }
+    ring->current = next;
+    ring->stats.active_frame = static_cast<uint32_t>(next);
+    if (frame.pending.load(std::memory_order_acquire) != 0) {
+        ring->stats.stalls++;
+        ring->accepting = false;
+        return;
+    }
+    frame.used = 0;
+    ring->accepting = true;
+}
+
+void filament_staging_ring_get_stats(const StagingRing* ring, StagingRingStats* out_stats) {
+    if (!ring || !out_stats) return;
+    *out_stats = ring->stats;
+}
+
+void filament_vertex_buffer_set_buffer_at_ring(
+    VertexBuffer* vb,
+    Engine* engine,
+    StagingRing* ring,
+    uint8_t buffer_index,
+    const void* data,
+    size_t size,
+    uint32_t dest_offset
+) {
+    if (!vb || !engine || !data || size == 0) return;
+    if (!ring) {
+        filament_vertex_buffer_set_buffer_at(vb, engine, buffer_index, data, size, dest_offset);
+        return;
+    }
+    ring->frame_bytes += size;
+    ring->stats.total_bytes += size;
+    if (ring->accepting) {
+        StagingRingFrame& frame = ring->frames[ring->current];
+        const size_t offset = (frame.used + 15) & ~size_t(15);
+        if (offset + size <= ring->bytes_per_frame) {
+            uint8_t* dst = ring->storage.data() + frame.base + offset;
+            memcpy(dst, data, size);
+            frame.used = offset + size;
+            frame.pending.fetch_add(1, std::memory_order_acq_rel);
+            ring->refs.fetch_add(1, std::memory_order_acq_rel);
+            backend::BufferDescriptor desc(dst, size, staging_ring_release, &frame);
+            vb->setBufferAt(*engine, buffer_index, std::move(desc), dest_offset);
+            return;
+        }
+    }
+    ring->stats.overflow_uploads++;
+    filament_vertex_buffer_set_buffer_at(vb, engine, buffer_index, data, size, dest_offset);
+}
+
 // ============================================================================
 // Renderable Manager
 // ============================================================================
@@ -770,121 +1605,140 @@ static LightManager::ShadowOptions build_shadow_options(
     return options;
 }
 
-int32_t filament_light_create(
-    Engine* engine,
-    EntityManager* em,
-    uint8_t light_type,
-    float color_r,
-    float color_g,
-    float color_b,
-    float intensity,
-    float pos_x,
-    float pos_y,
-    float pos_z,
-    float dir_x,
-    float dir_y,
-    float dir_z,
-    float range,
-    float spot_inner_deg,
-    float spot_outer_deg,
-    float sun_angular_radius_deg,
-    float sun_halo_size,
-    float sun_halo_falloff,
-    bool cast_shadows,
-    uint32_t shadow_map_size,
-    uint8_t shadow_cascades,
-    float shadow_far,
-    float shadow_near_hint,
-    float shadow_far_hint
-) {
-    if (!engine || !em) {
-        return 0;
-    }
-    LightManager::Type type = filament_light_type_from_u8(light_type);
-    LightManager::ShadowOptions shadow_options = build_shadow_options(
-        shadow_map_size,
-        shadow_cascades,
-        shadow_far,
-        shadow_near_hint,
-        shadow_far_hint
+// Light parameters shared by create and batched update. Angles are degrees.
+typedef struct {
+    uint8_t light_type;
+    float color[3];
+    float intensity;
+    float position[3];
+    float direction[3];
+    float range;
+    float spot_inner_deg;
+    float spot_outer_deg;
+    float sun_angular_radius_deg;
+    float sun_halo_size;
+    float sun_halo_falloff;
+    bool cast_shadows;
+    uint32_t shadow_map_size;
+    uint8_t shadow_cascades;
+    float shadow_far;
+    float shadow_near_hint;
+    float shadow_far_hint;
+} LightParamsC;
+
+// Dirty-field bits for filament_lights_update. Shadow options are applied only
+// when their bit is set, since resetting them can reallocate shadow maps.
+enum : uint32_t {
+    LIGHT_DIRTY_COLOR = 1u << 0,
+    LIGHT_DIRTY_INTENSITY = 1u << 1,
+    LIGHT_DIRTY_POSITION = 1u << 2,
+    LIGHT_DIRTY_DIRECTION = 1u << 3,
+    LIGHT_DIRTY_FALLOFF = 1u << 4,
+    LIGHT_DIRTY_SPOT_CONE = 1u << 5,
+    LIGHT_DIRTY_SUN = 1u << 6,
+    LIGHT_DIRTY_SHADOW_CASTER = 1u << 7,
+    LIGHT_DIRTY_SHADOW_OPTIONS = 1u << 8,
+};
+
+static LightManager::ShadowOptions shadow_options_from_params(const LightParamsC& params) {
+    return build_shadow_options(
+        params.shadow_map_size,
+        params.shadow_cascades,
+        params.shadow_far,
+        params.shadow_near_hint,
+        params.shadow_far_hint
     );
+}
+
+static void spot_cone_radians(const LightParamsC& params, float* inner_rad, float* outer_rad) {
     constexpr float DEG_TO_RAD = 0.017453292519943295f;
-    float spot_inner_rad = std::max(0.5f, spot_inner_deg) * DEG_TO_RAD;
-    float spot_outer_rad = std::max(spot_inner_deg, spot_outer_deg) * DEG_TO_RAD;
+    *inner_rad = std::max(0.5f, params.spot_inner_deg) * DEG_TO_RAD;
+    *outer_rad = std::max(params.spot_inner_deg, params.spot_outer_deg) * DEG_TO_RAD;
+}
+
+int32_t filament_light_create(Engine* engine, EntityManager* em, const LightParamsC* params) {
+    if (!engine || !em || !params) {
+        return 0;
+    }
+    const LightParamsC& p = *params;
+    float spot_inner_rad = 0.0f;
+    float spot_outer_rad = 0.0f;
+    spot_cone_radians(p, &spot_inner_rad, &spot_outer_rad);
 
     Entity entity = em->create();
-    LightManager::Builder(type)
-        .color({color_r, color_g, color_b})
-        .intensity(intensity)
-        .position({pos_x, pos_y, pos_z})
-        .direction({dir_x, dir_y, dir_z})
-        .falloff(std::max(0.01f, range))
+    LightManager::Builder(filament_light_type_from_u8(p.light_type))
+        .color({p.color[0], p.color[1], p.color[2]})
+        .intensity(p.intensity)
+        .position({p.position[0], p.position[1], p.position[2]})
+        .direction({p.direction[0], p.direction[1], p.direction[2]})
+        .falloff(std::max(0.01f, p.range))
         .spotLightCone(spot_inner_rad, spot_outer_rad)
-        .sunAngularRadius(std::max(0.01f, sun_angular_radius_deg))
-        .sunHaloSize(std::max(0.0f, sun_halo_size))
-        .sunHaloFalloff(std::max(0.0f, sun_halo_falloff))
-        .castShadows(cast_shadows)
-        .shadowOptions(shadow_options)
+        .sunAngularRadius(std::max(0.01f, p.sun_angular_radius_deg))
+        .sunHaloSize(std::max(0.0f, p.sun_halo_size))
+        .sunHaloFalloff(std::max(0.0f, p.sun_halo_falloff))
+        .castShadows(p.cast_shadows)
+        .shadowOptions(shadow_options_from_params(p))
         .build(*engine, entity);
     return Entity::smuggle(entity);
 }
 
-void filament_light_set(
+// Apply only the fields flagged in each light's dirty mask. Entities without a
+// light component and zero masks are skipped.
+void filament_lights_update(
     Engine* engine,
-    int32_t entity_id,
-    float color_r,
-    float color_g,
-    float color_b,
-    float intensity,
-    float pos_x,
-    float pos_y,
-    float pos_z,
-    float dir_x,
-    float dir_y,
-    float dir_z,
-    float range,
-    float spot_inner_deg,
-    float spot_outer_deg,
-    float sun_angular_radius_deg,
-    float sun_halo_size,
-    float sun_halo_falloff,
-    bool cast_shadows,
-    uint32_t shadow_map_size,
-    uint8_t shadow_cascades,
-    float shadow_far,
-    float shadow_near_hint,
-    float shadow_far_hint
+    const int32_t* entity_ids,
+    const LightParamsC* params,
+    const uint32_t* dirty_masks,
+    size_t count
 ) {
-    if (!engine) {
+    if (!engine || !entity_ids || !params || !dirty_masks) {
         return;
     }
-    Entity entity = Entity::import(entity_id);
     auto& lm = engine->getLightManager();
-    if (!lm.hasComponent(entity)) {
-        return;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t mask = dirty_masks[i];
+        if (mask == 0) {
+            continue;
+        }
+        Entity entity = Entity::import(entity_ids[i]);
+        if (!lm.hasComponent(entity)) {
+            continue;
+        }
+        auto instance = lm.getInstance(entity);
+        const LightParamsC& p = params[i];
+        if (mask & LIGHT_DIRTY_COLOR) {
+            lm.setColor(instance, {p.color[0], p.color[1], p.color[2]});
+        }
+        if (mask & LIGHT_DIRTY_INTENSITY) {
+            lm.setIntensity(instance, p.intensity);
+        }
+        if (mask & LIGHT_DIRTY_POSITION) {
+            lm.setPosition(instance, {p.position[0], p.position[1], p.position[2]});
+        }
+        if (mask & LIGHT_DIRTY_DIRECTION) {
+            lm.setDirection(instance, {p.direction[0], p.direction[1], p.direction[2]});
+        }
+        if (mask & LIGHT_DIRTY_FALLOFF) {
+            lm.setFalloff(instance, std::max(0.01f, p.range));
+        }
+        if (mask & LIGHT_DIRTY_SPOT_CONE) {
+            float spot_inner_rad = 0.0f;
+            float spot_outer_rad = 0.0f;
+            spot_cone_radians(p, &spot_inner_rad, &spot_outer_rad);
+            lm.setSpotLightCone(instance, spot_inner_rad, spot_outer_rad);
+        }
+        if (mask & LIGHT_DIRTY_SUN) {
+            lm.setSunAngularRadius(instance, std::max(0.01f, p.sun_angular_radius_deg));
+            lm.setSunHaloSize(instance, std::max(0.0f, p.sun_halo_size));
+            lm.setSunHaloFalloff(instance, std::max(0.0f, p.sun_halo_falloff));
+        }
+        if (mask & LIGHT_DIRTY_SHADOW_CASTER) {
+            lm.setShadowCaster(instance, p.cast_shadows);
+        }
+        if (mask & LIGHT_DIRTY_SHADOW_OPTIONS) {
+            lm.setShadowOptions(instance, shadow_options_from_params(p));
+        }
     }
-    auto instance = lm.getInstance(entity);
-    LightManager::ShadowOptions shadow_options = build_shadow_options(
-        shadow_map_size,
-        shadow_cascades,
-        shadow_far,
-        shadow_near_hint,
-        shadow_far_hint
-    );
-    constexpr float DEG_TO_RAD = 0.017453292519943295f;
-    float spot_inner_rad = std::max(0.5f, spot_inner_deg) * DEG_TO_RAD;
-    float spot_outer_rad = std::max(spot_inner_deg, spot_outer_deg) * DEG_TO_RAD;
-    lm.setColor(instance, {color_r, color_g, color_b});
-    lm.setIntensity(instance, intensity);
-    lm.setPosition(instance, {pos_x, pos_y, pos_z});
-    lm.setDirection(instance, {dir_x, dir_y, dir_z});
-    lm.setFalloff(instance, std::max(0.01f, range));
-    lm.setSpotLightCone(instance, spot_inner_rad, spot_outer_rad);
-    lm.setSunAngularRadius(instance, std::max(0.01f, sun_angular_radius_deg));
-    lm.setSunHaloSize(instance, std::max(0.0f, sun_halo_size));
-    lm.setSunHaloFalloff(instance, std::max(0.0f, sun_halo_falloff));
-    lm.setShadowCaster(instance, cast_shadows);
-    lm.setShadowOptions(instance, shadow_options);
 }
 
 // ============================================================================
@@ -903,10 +1757,36 @@ void filament_transform_manager_set_transform(
     if (!tm->hasComponent(entity)) {
         return;
     }
-    auto instance = tm->getInstance(entity);
-    filament::math::mat4f matrix;
-    std::memcpy(&matrix, matrix4x4, sizeof(float) * 16);
-    tm->setTransform(instance, matrix);
+    auto instance = tm->getInstance(entity);
+    filament::math::mat4f matrix;
+    std::memcpy(&matrix, matrix4x4, sizeof(float) * 16);
+    tm->setTransform(instance, matrix);
+}
+
+// Apply `count` local transforms in a single local-transform transaction so the
+// world hierarchy is resolved once at commit instead of once per entity.
+// `matrices4x4` holds `count` consecutive column-major 4x4 matrices.
+void filament_transform_manager_set_transforms(
+    TransformManager* tm,
+    const int32_t* entity_ids,
+    const float* matrices4x4,
+    size_t count
+) {
+    if (!tm || !entity_ids || !matrices4x4 || count == 0) {
+        return;
+    }
+    tm->openLocalTransformTransaction();
+    for (size_t i = 0; i < count; i++) {
+        Entity entity = Entity::import(entity_ids[i]);
+        auto instance = tm->getInstance(entity);
+        if (!instance) {
+            continue;
+        }
+        filament::math::mat4f matrix;
+        std::memcpy(&matrix, matrices4x4 + i * 16, sizeof(float) * 16);
+        tm->setTransform(instance, matrix);
+    }
+    tm->commitLocalTransformTransaction();
 }
 
 // ============================================================================
@@ -917,6 +1797,19 @@ MaterialProvider* filament_gltfio_create_jit_shader_provider(Engine* engine, boo
     return createJitShaderProvider(engine, optimize);
 }
 
+// Ubershader provider over a prebuilt .uberz archive. A null or empty archive
+// selects the default archive linked from the uberarchive library.
+MaterialProvider* filament_gltfio_create_ubershader_provider(
+    Engine* engine,
+    const uint8_t* archive,
+    uint32_t size
+) {
+    if (!archive || size == 0) {
+        return createUbershaderProvider(engine, UBERARCHIVE_DEFAULT_DATA, UBERARCHIVE_DEFAULT_SIZE);
+    }
+    return createUbershaderProvider(engine, archive, size);
+}
+
 void filament_gltfio_material_provider_destroy_materials(MaterialProvider* provider) {
     if (provider) {
         provider->destroyMaterials();
@@ -951,6 +1844,33 @@ FilamentAsset* filament_gltfio_asset_loader_create_asset_from_json(
     return loader->createAsset(data, size);
 }
 
+// Create an asset that can grow more instances later via createInstance. The
+// first instance is created up front.
+FilamentAsset* filament_gltfio_asset_loader_create_instanced_asset(
+    AssetLoader* loader,
+    const uint8_t* data,
+    uint32_t size
+) {
+    if (!loader || !data) {
+        return nullptr;
+    }
+    FilamentInstance* instance = nullptr;
+    return loader->createInstancedAsset(data, size, &instance, 1);
+}
+
+// Add an instance sharing the asset's vertex/index buffers and textures. Each
+// instance gets its own entities and material instances. Returns null if the
+// asset was not created instanced or its source data was released.
+FilamentInstance* filament_gltfio_asset_loader_create_instance(
+    AssetLoader* loader,
+    FilamentAsset* asset
+) {
+    if (!loader || !asset) {
+        return nullptr;
+    }
+    return loader->createInstance(asset);
+}
+
 void filament_gltfio_asset_loader_destroy_asset(AssetLoader* loader, FilamentAsset* asset) {
     loader->destroyAsset(asset);
 }
@@ -968,10 +1888,68 @@ void filament_gltfio_resource_loader_destroy(ResourceLoader* loader) {
     delete loader;
 }
 
+void filament_gltfio_resource_loader_set_configuration(
+    ResourceLoader* loader,
+    Engine* engine,
+    const char* gltf_path,
+    bool normalize_skinning_weights
+) {
+    if (!loader) return;
+    ResourceConfiguration config{engine, gltf_path, normalize_skinning_weights};
+    loader->setConfiguration(config);
+}
+
+void filament_gltfio_resource_loader_evict_resource_data(ResourceLoader* loader) {
+    if (!loader) return;
+    loader->evictResourceData();
+}
+
+// Register caller-owned bytes for `uri` so the loader uses them in place of
+// reading the file. `release` runs once the loader evicts the data.
+void filament_gltfio_resource_loader_add_resource_data(
+    ResourceLoader* loader,
+    const char* uri,
+    const void* data,
+    size_t size,
+    filament_buffer_release_fn release,
+    void* user
+) {
+    if (!loader || !uri || !data) {
+        if (release) release(const_cast<void*>(data), size, user);
+        return;
+    }
+    loader->addResourceData(uri,
+        backend::BufferDescriptor(data, size, release, user));
+}
+
 bool filament_gltfio_resource_loader_load_resources(ResourceLoader* loader, FilamentAsset* asset) {
     return loader->loadResources(asset);
 }
 
+bool filament_gltfio_resource_loader_async_begin_load(ResourceLoader* loader, FilamentAsset* asset) {
+    if (!loader || !asset) {
+        return false;
+    }
+    return loader->asyncBeginLoad(asset);
+}
+
+void filament_gltfio_resource_loader_async_update_load(ResourceLoader* loader) {
+    if (!loader) return;
+    loader->asyncUpdateLoad();
+}
+
+float filament_gltfio_resource_loader_async_get_load_progress(ResourceLoader* loader) {
+    if (!loader) {
+        return 0.0f;
+    }
+    return loader->asyncGetLoadProgress();
+}
+
+void filament_gltfio_resource_loader_async_cancel_load(ResourceLoader* loader) {
+    if (!loader) return;
+    loader->asyncCancelLoad();
+}
+
 void filament_gltfio_resource_loader_add_texture_provider(
     ResourceLoader* loader,
     const char* mime_type,
@@ -984,6 +1962,12 @@ TextureProvider* filament_gltfio_create_stb_texture_provider(Engine* engine) {
     return createStbProvider(engine);
 }
 
+// Transcodes KHR_texture_basisu images (image/ktx2) with Ktx2Reader.
+TextureProvider* filament_gltfio_create_ktx2_texture_provider(Engine* engine) {
+    if (!engine) return nullptr;
+    return createKtx2Provider(engine);
+}
+
 void filament_gltfio_destroy_texture_provider(TextureProvider* provider) {
     delete provider;
 }
@@ -994,6 +1978,11 @@ void filament_gltfio_asset_add_entities_to_scene(FilamentAsset* asset, Scene* sc
     scene->addEntities(entities, count);
 }
 
+void filament_gltfio_asset_remove_entities_from_scene(FilamentAsset* asset, Scene* scene) {
+    if (!asset || !scene) return;
+    scene->removeEntities(asset->getEntities(), asset->getEntityCount());
+}
+
 void filament_gltfio_asset_release_source_data(FilamentAsset* asset) {
     asset->releaseSourceData();
 }
@@ -1026,6 +2015,50 @@ FilamentInstance* filament_gltfio_asset_get_instance(FilamentAsset* asset) {
     return asset->getInstance();
 }
 
+int32_t filament_gltfio_instance_get_root(FilamentInstance* instance) {
+    if (!instance) {
+        return 0;
+    }
+    return Entity::smuggle(instance->getRoot());
+}
+
+void filament_gltfio_instance_add_entities_to_scene(FilamentInstance* instance, Scene* scene) {
+    if (!instance || !scene) return;
+    scene->addEntities(instance->getEntities(), instance->getEntityCount());
+}
+
+void filament_gltfio_instance_remove_entities_from_scene(FilamentInstance* instance, Scene* scene) {
+    if (!instance || !scene) return;
+    scene->removeEntities(instance->getEntities(), instance->getEntityCount());
+}
+
+int32_t filament_gltfio_instance_get_entity_count(FilamentInstance* instance) {
+    if (!instance) {
+        return 0;
+    }
+    return static_cast<int32_t>(instance->getEntityCount());
+}
+
+// Write the instance's renderable entities to out_entities; returns the number written.
+int32_t filament_gltfio_instance_get_renderable_entities(
+    Engine* engine,
+    FilamentInstance* instance,
+    int32_t* out_entities,
+    int32_t max_count
+) {
+    if (!engine || !instance || !out_entities || max_count <= 0) return 0;
+    auto& rm = engine->getRenderableManager();
+    const Entity* entities = instance->getEntities();
+    const size_t count = instance->getEntityCount();
+    int32_t written = 0;
+    for (size_t i = 0; i < count && written < max_count; i++) {
+        if (rm.hasComponent(entities[i])) {
+            out_entities[written++] = Entity::smuggle(entities[i]);
+        }
+    }
+    return written;
+}
+
 int32_t filament_gltfio_instance_get_material_instance_count(FilamentInstance* instance) {
     if (!instance) {
         return 0;
@@ -1047,6 +2080,429 @@ MaterialInstance* filament_gltfio_instance_get_material_instance(
     return instance->getMaterialInstances()[index];
 }
 
+// ============================================================================
+// Parallel texture decode
+// ============================================================================
+
+// gltfio TextureProvider that decodes PNG/JPEG with stb on a pool of worker
+// threads. At most `max_resident` images are decoding or decoded and waiting
+// for upload at once; uploads and mip generation run on the main thread in
+// updateQueue(), which waitForCompletion() drives while it waits.
+
+typedef struct {
+    uint32_t worker_count;
+    uint32_t max_resident;
+    uint32_t peak_resident;
+    uint64_t textures_pushed;
+    uint64_t textures_decoded;
+    uint64_t textures_failed;
+    uint64_t encoded_bytes;
+    uint64_t decoded_bytes;
+    // Summed across workers.
+    uint64_t decode_ns;
+    // Wall time with at least one texture outstanding.
+    uint64_t busy_ns;
+} TextureDecodeStatsC;
+
+class ParallelTextureProvider final : public TextureProvider {
+public:
+    ParallelTextureProvider(Engine* engine, uint32_t worker_count, uint32_t max_resident)
+        : mEngine(engine) {
+        if (worker_count == 0) {
+            const uint32_t hardware = std::thread::hardware_concurrency();
+            worker_count = hardware > 1 ? hardware - 1 : 1;
+        }
+        mStats.worker_count = worker_count;
+        mStats.max_resident = max_resident ? max_resident : worker_count * 2;
+        for (uint32_t i = 0; i < worker_count; i++) {
+            mWorkers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ParallelTextureProvider() override {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+        }
+        mWorkAvailable.notify_all();
+        for (auto& worker : mWorkers) {
+            worker.join();
+        }
+    }
+
+    Texture* pushTexture(const uint8_t* data, size_t byteCount, const char* mimeType,
+            TextureFlags flags) override {
+        mPushMessage.clear();
+        int width = 0, height = 0, components = 0;
+        if (!stbi_info_from_memory(data, static_cast<int>(byteCount), &width, &height, &components)) {
+            mPushMessage = std::string("Unable to parse ") + (mimeType ? mimeType : "image") + " header";
+            return nullptr;
+        }
+        const bool srgb = (static_cast<uint64_t>(flags)
+                & static_cast<uint64_t>(TextureFlags::sRGB)) != 0;
+        Texture* texture = Texture::Builder()
+            .width(static_cast<uint32_t>(width))
+            .height(static_cast<uint32_t>(height))
+            .levels(0xff)
+            .format(srgb ? Texture::InternalFormat::SRGB8_A8 : Texture::InternalFormat::RGBA8)
+            .usage(Texture::Usage::DEFAULT | Texture::Usage::GEN_MIPMAPPABLE)
+            .sampler(Texture::Sampler::SAMPLER_2D)
+            .build(*mEngine);
+        if (!texture) {
+            mPushMessage = "Unable to create texture";
+            return nullptr;
+        }
+        auto job = std::make_unique<DecodeJob>();
+        job->texture = texture;
+        job->encoded.assign(data, data + byteCount);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mPushedCount == mCompletedCount) {
+                mBusySince = std::chrono::steady_clock::now();
+            }
+            job->generation = mGeneration;
+            mPending.push_back(std::move(job));
+            mPushedCount++;
+            mStats.textures_pushed++;
+            mStats.encoded_bytes += byteCount;
+        }
+        mWorkAvailable.notify_one();
+        return texture;
+    }
+
+    Texture* popTexture() override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mPopQueue.empty()) {
+            return nullptr;
+        }
+        Texture* texture = mPopQueue.front();
+        mPopQueue.pop_front();
+        mPoppedCount++;
+        return texture;
+    }
+
+    void updateQueue() override {
+        std::deque<std::unique_ptr<DecodeJob>> ready;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ready.swap(mDecoded);
+        }
+        if (ready.empty()) {
+            return;
+        }
+        uint64_t decoded = 0, failed = 0, decoded_bytes = 0;
+        for (auto& job : ready) {
+            if (!job->pixels) {
+                mPopMessage = "Unable to decode texture";
+                failed++;
+                continue;
+            }
+            const size_t size = size_t(job->width) * job->height * 4;
+            Texture::PixelBufferDescriptor buffer(job->pixels, size,
+                Texture::Format::RGBA, Texture::Type::UBYTE,
+                [](void* pixels, size_t, void*) { stbi_image_free(pixels); });
+            job->texture->setImage(*mEngine, 0, std::move(buffer));
+            job->texture->generateMipmaps(*mEngine);
+            job->pixels = nullptr;
+            decoded++;
+            decoded_bytes += size;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            for (auto& job : ready) {
+                mPopQueue.push_back(job->texture);
+            }
+            mResident -= static_cast<uint32_t>(ready.size());
+            completeLocked(ready.size());
+            mStats.textures_decoded += decoded;
+            mStats.textures_failed += failed;
+            mStats.decoded_bytes += decoded_bytes;
+        }
+        mWorkAvailable.notify_all();
+    }
+
+    void waitForCompletion() override {
+        for (;;) {
+            updateQueue();
+            std::unique_lock<std::mutex> lock(mMutex);
+            if (mCompletedCount == mPushedCount) {
+                return;
+            }
+            mJobDone.wait(lock, [this] {
+                return !mDecoded.empty() || mCompletedCount == mPushedCount;
+            });
+        }
+    }
+
+    void cancelDecoding() override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // The asset that owns these textures may be destroyed next, so no
+        // reference to them may survive the cancel. Jobs from before it never
+        // touch their texture again, and uploaded textures still waiting to be
+        // popped are dropped rather than handed to the next loader.
+        mGeneration++;
+        const size_t dropped = mPending.size() + mDecoded.size() + mDecoding;
+        mPending.clear();
+        mResident -= static_cast<uint32_t>(mDecoded.size());
+        mDecoded.clear();
+        // Queued textures already count as completed; they count as popped here
+        // and nowhere else.
+        mPoppedCount += dropped + mPopQueue.size();
+        mPopQueue.clear();
+        completeLocked(dropped);
+    }
+
+    const char* getPushMessage() const override {
+        return mPushMessage.empty() ? nullptr : mPushMessage.c_str();
+    }
+
+    const char* getPopMessage() const override {
+        return mPopMessage.empty() ? nullptr : mPopMessage.c_str();
+    }
+
+    size_t getPushedCount() const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mPushedCount;
+    }
+
+    size_t getPoppedCount() const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mPoppedCount;
+    }
+
+    size_t getDecodedCount() const override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCompletedCount;
+    }
+
+    void getStats(TextureDecodeStatsC* out) const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        *out = mStats;
+        if (mPushedCount != mCompletedCount) {
+            out->busy_ns += elapsedNs(mBusySince);
+        }
+    }
+
+private:
+    struct DecodeJob {
+        Texture* texture = nullptr;
+        std::vector<uint8_t> encoded;
+        stbi_uc* pixels = nullptr;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t generation = 0;
+
+        ~DecodeJob() { stbi_image_free(pixels); }
+    };
+
+    static uint64_t elapsedNs(std::chrono::steady_clock::time_point since) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - since).count());
+    }
+
+    void completeLocked(size_t count) {
+        mCompletedCount += count;
+        if (count && mCompletedCount == mPushedCount) {
+            mStats.busy_ns += elapsedNs(mBusySince);
+        }
+    }
+
+    void workerLoop() {
+        for (;;) {
+            std::unique_ptr<DecodeJob> job;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWorkAvailable.wait(lock, [this] {
+                    return mStopping
+                        || (!mPending.empty() && mResident < mStats.max_resident);
+                });
+                if (mStopping) {
+                    return;
+                }
+                job = std::move(mPending.front());
+                mPending.pop_front();
+                mResident++;
+                mDecoding++;
+                mStats.peak_resident = std::max(mStats.peak_resident, mResident);
+            }
+            const auto start = std::chrono::steady_clock::now();
+            int width = 0, height = 0, components = 0;
+            job->pixels = stbi_load_from_memory(job->encoded.data(),
+                static_cast<int>(job->encoded.size()), &width, &height, &components, 4);
+            job->width = static_cast<uint32_t>(width);
+            job->height = static_cast<uint32_t>(height);
+            job->encoded = {};
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mStats.decode_ns += elapsedNs(start);
+                mDecoding--;
+                if (job->generation != mGeneration) {
+                    // Cancelled mid-decode and already counted as completed.
+                    mResident--;
+                } else {
+                    mDecoded.push_back(std::move(job));
+                }
+            }
+            mJobDone.notify_all();
+            mWorkAvailable.notify_one();
+        }
+    }
+
+    Engine* mEngine;
+    std::vector<std::thread> mWorkers;
+    mutable std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mJobDone;
+    std::deque<std::unique_ptr<DecodeJob>> mPending;
+    std::deque<std::unique_ptr<DecodeJob>> mDecoded;
+    std::deque<Texture*> mPopQueue;
+    uint64_t mGeneration = 0;
+    // Images decoding or decoded and not yet uploaded.
+    uint32_t mResident = 0;
+    uint32_t mDecoding = 0;
+    size_t mPushedCount = 0;
+    size_t mPoppedCount = 0;
+    size_t mCompletedCount = 0;
+    bool mStopping = false;
+    std::chrono::steady_clock::time_point mBusySince{};
+    std::string mPushMessage;
+    std::string mPopMessage;
+    TextureDecodeStatsC mStats{};
+};
+
+// `worker_count` 0 uses one fewer than the hardware threads; `max_resident` 0
+// allows two decoded images per worker.
+TextureProvider* filament_gltfio_create_parallel_texture_provider(
+    Engine* engine,
+    uint32_t worker_count,
+    uint32_t max_resident
+) {
+    if (!engine) return nullptr;
+    return new ParallelTextureProvider(engine, worker_count, max_resident);
+}
+
+void filament_gltfio_parallel_texture_provider_get_stats(
+    TextureProvider* provider,
+    TextureDecodeStatsC* out_stats
+) {
+    if (!provider || !out_stats) return;
+    static_cast<ParallelTextureProvider*>(provider)->getStats(out_stats);
+}
+
+// Direct TextureProvider calls, normally made by ResourceLoader. Used to drive
+// a provider without an asset.
+Texture* filament_gltfio_texture_provider_push(
+    TextureProvider* provider,
+    const uint8_t* data,
+    size_t size,
+    const char* mime_type,
+    uint64_t flags
+) {
+    if (!provider || !data) return nullptr;
+    return provider->pushTexture(data, size, mime_type,
+        static_cast<TextureProvider::TextureFlags>(flags));
+}
+
+Texture* filament_gltfio_texture_provider_pop(TextureProvider* provider) {
+    if (!provider) return nullptr;
+    return provider->popTexture();
+}
+
+void filament_gltfio_texture_provider_wait(TextureProvider* provider) {
+    if (!provider) return;
+    provider->waitForCompletion();
+}
+
+void filament_gltfio_texture_provider_cancel(TextureProvider* provider) {
+    if (!provider) return;
+    provider->cancelDecoding();
+}
+
+void filament_gltfio_texture_provider_get_counts(
+    TextureProvider* provider,
+    size_t* out_pushed,
+    size_t* out_popped,
+    size_t* out_decoded
+) {
+    if (!provider || !out_pushed || !out_popped || !out_decoded) return;
+    *out_pushed = provider->getPushedCount();
+    *out_popped = provider->getPoppedCount();
+    *out_decoded = provider->getDecodedCount();
+}
+
+// ============================================================================
+// Mesh decode
+// ============================================================================
+
+// EXT_meshopt_compression modes and filters, in the extension's order.
+enum MeshoptMode : uint32_t {
+    MESHOPT_MODE_ATTRIBUTES = 0,
+    MESHOPT_MODE_TRIANGLES = 1,
+    MESHOPT_MODE_INDICES = 2,
+};
+
+enum MeshoptFilter : uint32_t {
+    MESHOPT_FILTER_NONE = 0,
+    MESHOPT_FILTER_OCTAHEDRAL = 1,
+    MESHOPT_FILTER_QUATERNION = 2,
+    MESHOPT_FILTER_EXPONENTIAL = 3,
+};
+
+// Decode one EXT_meshopt_compression buffer view into `dst`, which must hold
+// count * stride bytes. The filters write the accessor's declared component
+// type, so quantized attributes stay quantized. Thread safe; the importer
+// calls this from its worker threads. Returns false on malformed input;
+// meshoptimizer asserts on bad parameters, so every size it requires is
+// checked here first.
+bool filament_meshopt_decode_buffer_view(
+    uint32_t mode,
+    uint32_t filter,
+    size_t count,
+    size_t stride,
+    const uint8_t* src,
+    size_t src_size,
+    uint8_t* dst
+) {
+    if (!src || !dst || count == 0 || stride == 0) return false;
+    int result = -1;
+    switch (mode) {
+        case MESHOPT_MODE_ATTRIBUTES:
+            if (stride % 4 != 0 || stride > 256) return false;
+            result = meshopt_decodeVertexBuffer(dst, count, stride, src, src_size);
+            break;
+        case MESHOPT_MODE_TRIANGLES:
+            if ((stride != 2 && stride != 4) || count % 3 != 0) return false;
+            result = meshopt_decodeIndexBuffer(dst, count, stride, src, src_size);
+            break;
+        case MESHOPT_MODE_INDICES:
+            if (stride != 2 && stride != 4) return false;
+            result = meshopt_decodeIndexSequence(dst, count, stride, src, src_size);
+            break;
+        default:
+            return false;
+    }
+    if (result != 0) return false;
+    switch (filter) {
+        case MESHOPT_FILTER_NONE:
+            break;
+        case MESHOPT_FILTER_OCTAHEDRAL:
+            if (stride != 4 && stride != 8) return false;
+            meshopt_decodeFilterOct(dst, count, stride);
+            break;
+        case MESHOPT_FILTER_QUATERNION:
+            if (stride != 8) return false;
+            meshopt_decodeFilterQuat(dst, count, stride);
+            break;
+        case MESHOPT_FILTER_EXPONENTIAL:
+            if (stride % 4 != 0) return false;
+            meshopt_decodeFilterExp(dst, count, stride);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
 // ============================================================================
 // filagui
 // ============================================================================
@@ -1822,6 +3278,36 @@ bool filament_texture_set_image_rgba8(
     return true;
 }
 
+// Zero-copy variant of filament_texture_set_image_rgba8. On success Filament
+// reads `pixels` in place and calls `release` when done; on failure `release`
+// is called immediately so the caller always gets its buffer back.
+bool filament_texture_set_image_rgba8_owned(
+    Engine* engine,
+    Texture* texture,
+    uint32_t width,
+    uint32_t height,
+    void* pixels,
+    size_t size,
+    filament_buffer_release_fn release,
+    void* user
+) {
+    const uint64_t required = static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * 4ull;
+    if (!engine || !texture || !pixels || required == 0 || required > size) {
+        if (release) release(pixels, size, user);
+        return false;
+    }
+    auto pbd = backend::PixelBufferDescriptor(
+        pixels,
+        static_cast<size_t>(required),
+        backend::PixelDataFormat::RGBA,
+        backend::PixelDataType::UBYTE,
+        release,
+        user
+    );
+    texture->setImage(*engine, 0, std::move(pbd));
+    return true;
+}
+
 RenderTarget* filament_render_target_create(
     Engine* engine,
     Texture* color,
@@ -1873,20 +3359,108 @@ bool filament_renderer_read_pixels(
     if (buffer_size < required) {
         return false;
     }
-    std::atomic<bool> done{false};
+    // Completion is observed through the caller's flushAndWait(); the callback
+    // must not reference this stack frame since it can run after we return.
     auto pbd = backend::PixelBufferDescriptor(
         out_buffer,
         required,
         backend::PixelDataFormat::RGBA,
         backend::PixelDataType::UBYTE,
+        [](void* /*buffer*/, size_t /*size*/, void* /*user*/) {},
+        nullptr
+    );
+    renderer->readPixels(render_target, x, y, width, height, std::move(pbd));
+    return true; // Caller must flushAndWait() to complete
+}
+
+// Non-blocking readback into a reusable AsyncReadback slot. The slot owns its
+// pixel storage; the PixelBufferDescriptor callback marks it ready and the
+// caller polls on later frames instead of calling flushAndWait().
+struct AsyncReadback {
+    std::vector<uint8_t> pixels;
+    uint32_t size = 0;
+    std::atomic<bool> in_flight{false};
+    std::atomic<bool> ready{false};
+    // One reference for the owner plus one while a readback is in flight.
+    std::atomic<uint32_t> refs{1};
+};
+
+static void async_readback_release(AsyncReadback* readback) {
+    if (readback->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete readback;
+    }
+}
+
+AsyncReadback* filament_async_readback_create(uint32_t capacity_bytes) {
+    if (capacity_bytes == 0) {
+        return nullptr;
+    }
+    auto* readback = new AsyncReadback();
+    readback->pixels.resize(capacity_bytes);
+    return readback;
+}
+
+// Safe to call while a readback is in flight: the completion callback frees
+// the slot instead.
+void filament_async_readback_destroy(AsyncReadback* readback) {
+    if (!readback) return;
+    async_readback_release(readback);
+}
+
+bool filament_async_readback_is_busy(const AsyncReadback* readback) {
+    if (!readback) return false;
+    return readback->in_flight.load(std::memory_order_acquire)
+        || readback->ready.load(std::memory_order_acquire);
+}
+
+// Copy out a completed readback and free the slot. Returns the byte count
+// copied, or 0 while the readback is still in flight (or nothing was issued).
+uint32_t filament_async_readback_poll(AsyncReadback* readback, uint8_t* out_buffer, uint32_t buffer_size) {
+    if (!readback || !readback->ready.load(std::memory_order_acquire)) {
+        return 0;
+    }
+    const uint32_t copied = std::min(readback->size, buffer_size);
+    if (out_buffer && copied > 0) {
+        memcpy(out_buffer, readback->pixels.data(), copied);
+    }
+    readback->ready.store(false, std::memory_order_release);
+    return copied;
+}
+
+bool filament_renderer_read_pixels_async(
+    Renderer* renderer,
+    RenderTarget* render_target,
+    uint32_t x,
+    uint32_t y,
+    uint32_t width,
+    uint32_t height,
+    AsyncReadback* readback
+) {
+    if (!renderer || !render_target || !readback || filament_async_readback_is_busy(readback)) {
+        return false;
+    }
+    const uint64_t required = static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * 4ull;
+    if (required == 0 || required > readback->pixels.size()) {
+        return false;
+    }
+    readback->size = static_cast<uint32_t>(required);
+    readback->in_flight.store(true, std::memory_order_release);
+    readback->refs.fetch_add(1, std::memory_order_acq_rel);
+    auto pbd = backend::PixelBufferDescriptor(
+        readback->pixels.data(),
+        static_cast<size_t>(required),
+        backend::PixelDataFormat::RGBA,
+        backend::PixelDataType::UBYTE,
         [](void* /*buffer*/, size_t /*size*/, void* user) {
-            auto* flag = static_cast<std::atomic<bool>*>(user);
-            flag->store(true, std::memory_order_release);
+            auto* slot = static_cast<AsyncReadback*>(user);
+            slot->ready.store(true, std::memory_order_release);
+            slot->in_flight.store(false, std::memory_order_release);
+            async_readback_release(slot);
         },
-        &done
+        readback
     );
     renderer->readPixels(render_target, x, y, width, height, std::move(pbd));
-    return true; // Caller must flushAndWait() to complete
+    return true;
 }
 
 // Synchronous readback from the current swap chain frame.
@@ -1909,17 +3483,15 @@ bool filament_renderer_read_pixels_swap_chain(
     if (buffer_size < required) {
         return false;
     }
-    std::atomic<bool> done{false};
+    // Completion is observed through the caller's flushAndWait(); the callback
+    // must not reference this stack frame since it can run after we return.
     auto pbd = backend::PixelBufferDescriptor(
         out_buffer,
         required,
         backend::PixelDataFormat::RGBA,
         backend::PixelDataType::UBYTE,
-        [](void* /*buffer*/, size_t /*size*/, void* user) {
-            auto* flag = static_cast<std::atomic<bool>*>(user);
-            flag->store(true, std::memory_order_release);
-        },
-        &done
+        [](void* /*buffer*/, size_t /*size*/, void* /*user*/) {},
+        nullptr
     );
     renderer->readPixels(x, y, width, height, std::move(pbd));
     return true; // Caller must flushAndWait() to complete
@@ -1982,6 +3554,96 @@ void filament_renderable_set_layer_mask(
     rm.setLayerMask(instance, select, values);
 }
 
+// ============================================================================
+// RenderableManager - batched material override set (pick / outline passes)
+// ============================================================================
+
+// Saved renderable state for one overridden entity. Primitive materials are
+// stored in `MaterialOverrideSet::materials` starting at `first_material`.
+typedef struct {
+    Entity entity;
+    uint8_t layer_mask;
+    size_t first_material;
+    size_t material_count;
+} SavedRenderableOverride;
+
+typedef struct {
+    Engine* engine;
+    std::vector<SavedRenderableOverride> saved;
+    std::vector<MaterialInstance const*> materials;
+} MaterialOverrideSet;
+
+MaterialOverrideSet* filament_material_override_set_create(Engine* engine) {
+    if (!engine) return nullptr;
+    auto* set = new MaterialOverrideSet();
+    set->engine = engine;
+    return set;
+}
+
+// Does not restore pending overrides; call pop before destroying.
+void filament_material_override_set_destroy(MaterialOverrideSet* set) {
+    delete set;
+}
+
+// Save the current materials and layer mask of each entity, then bind
+// `instances[i]` to every primitive of `entity_ids[i]` and set its layer mask
+// to `layer_values[i]`. Returns the number of primitives overridden.
+int32_t filament_material_override_set_push(
+    MaterialOverrideSet* set,
+    const int32_t* entity_ids,
+    MaterialInstance* const* instances,
+    const uint8_t* layer_values,
+    size_t count
+) {
+    if (!set || !set->engine || !entity_ids || !instances || !layer_values) return 0;
+    auto& rm = set->engine->getRenderableManager();
+    size_t overridden = 0;
+    set->saved.reserve(set->saved.size() + count);
+    for (size_t i = 0; i < count; i++) {
+        MaterialInstance* mi = instances[i];
+        if (!mi) continue;
+        Entity entity = Entity::import(entity_ids[i]);
+        auto instance = rm.getInstance(entity);
+        if (!instance) continue;
+        const size_t primitive_count = rm.getPrimitiveCount(instance);
+        if (primitive_count == 0) continue;
+        SavedRenderableOverride saved;
+        saved.entity = entity;
+        saved.layer_mask = rm.getLayerMask(instance);
+        saved.first_material = set->materials.size();
+        saved.material_count = primitive_count;
+        for (size_t p = 0; p < primitive_count; p++) {
+            set->materials.push_back(rm.getMaterialInstanceAt(instance, p));
+            rm.setMaterialInstanceAt(instance, p, mi);
+        }
+        rm.setLayerMask(instance, 0xFF, layer_values[i]);
+        set->saved.push_back(saved);
+        overridden += primitive_count;
+    }
+    return static_cast<int32_t>(overridden);
+}
+
+// Restore everything saved by push calls since the last pop. Entries are
+// restored newest first so an entity pushed twice ends in its original state.
+void filament_material_override_set_pop(MaterialOverrideSet* set) {
+    if (!set || !set->engine) return;
+    auto& rm = set->engine->getRenderableManager();
+    for (auto it = set->saved.rbegin(); it != set->saved.rend(); ++it) {
+        auto instance = rm.getInstance(it->entity);
+        if (!instance) continue;
+        const size_t primitive_count = std::min(it->material_count, rm.getPrimitiveCount(instance));
+        for (size_t p = 0; p < primitive_count; p++) {
+            MaterialInstance const* original = set->materials[it->first_material + p];
+            if (original) {
+                rm.setMaterialInstanceAt(instance, p, original);
+            }
+        }
+        rm.setLayerMask(instance, 0xFF, it->layer_mask);
+    }
+    set->saved.clear();
+    set->materials.clear();
+}
+
 // Get all renderable entities from a gltfio FilamentAsset
 int32_t filament_gltfio_asset_get_entities(
     FilamentAsset* asset,
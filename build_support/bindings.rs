@@ -29,6 +29,141 @@ pub type FilamentAsset = c_void;
 pub type FilamentInstance = c_void;
 pub type ImGuiHelper = c_void;
 pub type RenderTarget = c_void;
+pub type MaterialOverrideSet = c_void;
+pub type StagingRing = c_void;
+pub type AsyncReadback = c_void;
+pub type ViewPickQuery = c_void;
+pub type MaterialWarmup = c_void;
+pub type Fence = c_void;
+pub type Ktx2Transcode = c_void;
+
+/// Release callback for caller-owned upload memory (see `*_owned` upload functions).
+pub type BufferReleaseCallback =
+    Option<unsafe extern "C" fn(buffer: *mut c_void, size: usize, user: *mut c_void)>;
+
+/// Counters reported by a staging ring (mirrors `StagingRingStats` in bindings.cpp).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct StagingRingStats {
+    pub frame_count: u32,
+    pub active_frame: u32,
+    pub bytes_per_frame: u64,
+    pub frames_advanced: u64,
+    pub last_frame_bytes: u64,
+    pub peak_frame_bytes: u64,
+    pub total_bytes: u64,
+    pub stalls: u64,
+    pub overflow_uploads: u64,
+}
+
+/// Result of a `View::pick` query (mirrors `ViewPickResult` in bindings.cpp).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct ViewPickResult {
+    pub entity: i32,
+    pub depth: f32,
+    pub frag_x: f32,
+    pub frag_y: f32,
+    pub frag_z: f32,
+    pub world_x: f32,
+    pub world_y: f32,
+    pub world_z: f32,
+}
+
+/// Program binary cache counters (mirrors `ProgramCacheStatsC` in bindings.cpp).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct ProgramCacheStatsC {
+    pub hits: u64,
+    pub misses: u64,
+    pub stores: u64,
+    pub bytes_read: u64,
+    pub bytes_written: u64,
+}
+
+/// Parallel texture provider counters (mirrors `TextureDecodeStatsC` in bindings.cpp).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct TextureDecodeStatsC {
+    pub worker_count: u32,
+    pub max_resident: u32,
+    pub peak_resident: u32,
+    pub textures_pushed: u64,
+    pub textures_decoded: u64,
+    pub textures_failed: u64,
+    pub encoded_bytes: u64,
+    pub decoded_bytes: u64,
+    pub decode_ns: u64,
+    pub busy_ns: u64,
+}
+
+/// Engine::Config sizing (mirrors `EngineConfigC` in bindings.cpp). Zero fields
+/// keep Filament's defaults.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct EngineConfigC {
+    pub command_buffer_size_mb: u32,
+    pub per_render_pass_arena_size_mb: u32,
+    pub driver_handle_arena_size_mb: u32,
+    pub min_command_buffer_size_mb: u32,
+    pub per_frame_commands_size_mb: u32,
+    pub job_system_thread_count: u32,
+    pub resource_allocator_cache_size_mb: u32,
+    pub resource_allocator_cache_max_age: u32,
+}
+
+/// Light parameters for create and batched update (mirrors `LightParamsC` in
+/// bindings.cpp). Angles are degrees.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct LightParamsC {
+    pub light_type: u8,
+    pub color: [f32; 3],
+    pub intensity: f32,
+    pub position: [f32; 3],
+    pub direction: [f32; 3],
+    pub range: f32,
+    pub spot_inner_deg: f32,
+    pub spot_outer_deg: f32,
+    pub sun_angular_radius_deg: f32,
+    pub sun_halo_size: f32,
+    pub sun_halo_falloff: f32,
+    pub cast_shadows: bool,
+    pub shadow_map_size: u32,
+    pub shadow_cascades: u8,
+    pub shadow_far: f32,
+    pub shadow_near_hint: f32,
+    pub shadow_far_hint: f32,
+}
+
+// Dirty-field bits for `filament_lights_update` (mirror bindings.cpp).
+pub const LIGHT_DIRTY_COLOR: u32 = 1 << 0;
+pub const LIGHT_DIRTY_INTENSITY: u32 = 1 << 1;
+pub const LIGHT_DIRTY_POSITION: u32 = 1 << 2;
+pub const LIGHT_DIRTY_DIRECTION: u32 = 1 << 3;
+pub const LIGHT_DIRTY_FALLOFF: u32 = 1 << 4;
+pub const LIGHT_DIRTY_SPOT_CONE: u32 = 1 << 5;
+pub const LIGHT_DIRTY_SUN: u32 = 1 << 6;
+pub const LIGHT_DIRTY_SHADOW_CASTER: u32 = 1 << 7;
+pub const LIGHT_DIRTY_SHADOW_OPTIONS: u32 = 1 << 8;
+
+// Variant filter bits for `filament_material_compile` (mirror Filament's
+// `UserVariantFilterBit`).
+pub const VARIANT_FILTER_DIRECTIONAL_LIGHTING: u32 = 0x01;
+pub const VARIANT_FILTER_DYNAMIC_LIGHTING: u32 = 0x02;
+pub const VARIANT_FILTER_SHADOW_RECEIVER: u32 = 0x04;
+pub const VARIANT_FILTER_SKINNING: u32 = 0x08;
+pub const VARIANT_FILTER_FOG: u32 = 0x10;
+
+// EXT_meshopt_compression modes and filters for
+// `filament_meshopt_decode_buffer_view`.
+pub const MESHOPT_MODE_ATTRIBUTES: u32 = 0;
+pub const MESHOPT_MODE_TRIANGLES: u32 = 1;
+pub const MESHOPT_MODE_INDICES: u32 = 2;
+pub const MESHOPT_FILTER_NONE: u32 = 0;
+pub const MESHOPT_FILTER_OCTAHEDRAL: u32 = 1;
+pub const MESHOPT_FILTER_QUATERNION: u32 = 2;
+pub const MESHOPT_FILTER_EXPONENTIAL: u32 = 3;
 
 // Builder wrapper types (opaque)
 pub type MaterialBuilderWrapper = c_void;
@@ -42,6 +177,16 @@ extern "C" {
     // ========================================================================
     
     pub fn filament_engine_create(backend: u8) -> *mut Engine;
+    pub fn filament_engine_create_with_config(
+        backend: u8,
+        config: *const EngineConfigC,
+    ) -> *mut Engine;
+    pub fn filament_engine_get_config(engine: *const Engine, out_config: *mut EngineConfigC);
+    pub fn filament_engine_enable_program_cache(
+        engine: *mut Engine,
+        directory: *const c_char,
+    ) -> bool;
+    pub fn filament_program_cache_get_stats(out_stats: *mut ProgramCacheStatsC);
     pub fn filament_engine_destroy(engine: *mut *mut Engine);
     pub fn filament_engine_destroy_entity(engine: *mut Engine, entity: i32);
     
@@ -69,6 +214,16 @@ extern "C" {
     pub fn filament_engine_get_renderable_manager(engine: *mut Engine) -> *mut RenderableManager;
     
     pub fn filament_engine_flush_and_wait(engine: *mut Engine);
+    pub fn filament_engine_flush(engine: *mut Engine);
+    pub fn filament_engine_pump_message_queues(engine: *mut Engine);
+    
+    // ========================================================================
+    // Fence
+    // ========================================================================
+    
+    pub fn filament_engine_create_fence(engine: *mut Engine) -> *mut Fence;
+    pub fn filament_engine_destroy_fence(engine: *mut Engine, fence: *mut Fence);
+    pub fn filament_fence_poll(fence: *mut Fence) -> i32;
     
     // ========================================================================
     // Renderer
@@ -105,6 +260,20 @@ extern "C" {
     );
     pub fn filament_view_set_post_processing_enabled(view: *mut View, enabled: bool);
     pub fn filament_view_set_visible_layers(view: *mut View, select: u8, values: u8);
+
+    pub fn filament_view_pick_query_create() -> *mut ViewPickQuery;
+    pub fn filament_view_pick_query_destroy(query: *mut ViewPickQuery);
+    pub fn filament_view_pick_query_is_busy(query: *const ViewPickQuery) -> bool;
+    pub fn filament_view_pick_query_poll(
+        query: *mut ViewPickQuery,
+        out_result: *mut ViewPickResult,
+    ) -> bool;
+    pub fn filament_view_pick(
+        view: *mut View,
+        window_x: u32,
+        window_y: u32,
+        query: *mut ViewPickQuery,
+    ) -> bool;
     
     // ========================================================================
     // Scene
@@ -167,6 +336,7 @@ extern "C" {
         up_y: f32,
         up_z: f32,
     );
+    pub fn filament_camera_get_view_projection(camera: *mut Camera, out_matrix4x4: *mut f64);
     
     // ========================================================================
     // Entity Manager
@@ -195,6 +365,21 @@ extern "C" {
         material: *mut Material,
     ) -> *mut MaterialInstance;
     pub fn filament_material_create_instance(material: *mut Material) -> *mut MaterialInstance;
+    pub fn filament_material_compile(material: *mut Material, variants: u32, high_priority: bool);
+    pub fn filament_material_warmup_create() -> *mut MaterialWarmup;
+    pub fn filament_material_warmup_destroy(warmup: *mut MaterialWarmup);
+    pub fn filament_material_warmup_add(
+        warmup: *mut MaterialWarmup,
+        material: *mut Material,
+        variants: u32,
+    ) -> bool;
+    pub fn filament_material_warmup_add_instance(
+        warmup: *mut MaterialWarmup,
+        instance: *mut MaterialInstance,
+        variants: u32,
+    ) -> bool;
+    pub fn filament_material_warmup_get_count(warmup: *const MaterialWarmup) -> u32;
+    pub fn filament_material_warmup_get_pending(warmup: *const MaterialWarmup) -> u32;
     pub fn filament_engine_destroy_material_instance(
         engine: *mut Engine,
         instance: *mut MaterialInstance,
@@ -248,6 +433,31 @@ extern "C" {
         wrap_repeat_v: bool,
         out_texture: *mut *mut Texture,
     ) -> bool;
+    pub fn filament_material_instance_set_texture_from_ktx_bytes(
+        engine: *mut Engine,
+        instance: *mut MaterialInstance,
+        name: *const c_char,
+        data: *const u8,
+        size: usize,
+        wrap_repeat_u: bool,
+        wrap_repeat_v: bool,
+        out_texture: *mut *mut Texture,
+    ) -> bool;
+    pub fn filament_ktx2_transcode_create(
+        engine: *mut Engine,
+        data: *const u8,
+        size: usize,
+    ) -> *mut Ktx2Transcode;
+    pub fn filament_ktx2_transcode_run(transcode: *mut Ktx2Transcode) -> bool;
+    pub fn filament_material_instance_set_texture_from_ktx2_transcode(
+        instance: *mut MaterialInstance,
+        name: *const c_char,
+        transcode: *mut Ktx2Transcode,
+        wrap_repeat_u: bool,
+        wrap_repeat_v: bool,
+        out_texture: *mut *mut Texture,
+    ) -> bool;
+    pub fn filament_ktx2_transcode_destroy(engine: *mut Engine, transcode: *mut Ktx2Transcode);
     pub fn filament_material_instance_set_texture(
         instance: *mut MaterialInstance,
         name: *const c_char,
@@ -297,6 +507,16 @@ extern "C" {
         size: usize,
         dest_offset: u32,
     );
+    pub fn filament_vertex_buffer_set_buffer_at_owned(
+        vb: *mut VertexBuffer,
+        engine: *mut Engine,
+        buffer_index: u8,
+        data: *mut c_void,
+        size: usize,
+        dest_offset: u32,
+        release: BufferReleaseCallback,
+        user: *mut c_void,
+    );
     
     // ========================================================================
     // Index Buffer
@@ -324,6 +544,37 @@ extern "C" {
         size: usize,
         dest_offset: u32,
     );
+    pub fn filament_index_buffer_set_buffer_owned(
+        ib: *mut IndexBuffer,
+        engine: *mut Engine,
+        data: *mut c_void,
+        size: usize,
+        dest_offset: u32,
+        release: BufferReleaseCallback,
+        user: *mut c_void,
+    );
+    
+    // ========================================================================
+    // Staging ring for dynamic geometry uploads
+    // ========================================================================
+    
+    pub fn filament_staging_ring_create(
+        engine: *mut Engine,
+        frame_count: u32,
+        bytes_per_frame: usize,
+    ) -> *mut StagingRing;
+    pub fn filament_staging_ring_destroy(ring: *mut StagingRing);
+    pub fn filament_staging_ring_advance_frame(ring: *mut StagingRing);
+    pub fn filament_staging_ring_get_stats(ring: *const StagingRing, out_stats: *mut StagingRingStats);
+    pub fn filament_vertex_buffer_set_buffer_at_ring(
+        vb: *mut VertexBuffer,
+        engine: *mut Engine,
+        ring: *mut StagingRing,
+        buffer_index: u8,
+        data: *const c_void,
+        size: usize,
+        dest_offset: u32,
+    );
     
     // ========================================================================
     // Renderable Manager
@@ -373,55 +624,14 @@ extern "C" {
     pub fn filament_light_create(
         engine: *mut Engine,
         entity_manager: *mut EntityManager,
-        light_type: u8,
-        color_r: f32,
-        color_g: f32,
-        color_b: f32,
-        intensity: f32,
-        pos_x: f32,
-        pos_y: f32,
-        pos_z: f32,
-        dir_x: f32,
-        dir_y: f32,
-        dir_z: f32,
-        range: f32,
-        spot_inner_deg: f32,
-        spot_outer_deg: f32,
-        sun_angular_radius_deg: f32,
-        sun_halo_size: f32,
-        sun_halo_falloff: f32,
-        cast_shadows: bool,
-        shadow_map_size: u32,
-        shadow_cascades: u8,
-        shadow_far: f32,
-        shadow_near_hint: f32,
-        shadow_far_hint: f32,
+        params: *const LightParamsC,
     ) -> i32;
-    pub fn filament_light_set(
+    pub fn filament_lights_update(
         engine: *mut Engine,
-        entity_id: i32,
-        color_r: f32,
-        color_g: f32,
-        color_b: f32,
-        intensity: f32,
-        pos_x: f32,
-        pos_y: f32,
-        pos_z: f32,
-        dir_x: f32,
-        dir_y: f32,
-        dir_z: f32,
-        range: f32,
-        spot_inner_deg: f32,
-        spot_outer_deg: f32,
-        sun_angular_radius_deg: f32,
-        sun_halo_size: f32,
-        sun_halo_falloff: f32,
-        cast_shadows: bool,
-        shadow_map_size: u32,
-        shadow_cascades: u8,
-        shadow_far: f32,
-        shadow_near_hint: f32,
-        shadow_far_hint: f32,
+        entity_ids: *const i32,
+        params: *const LightParamsC,
+        dirty_masks: *const u32,
+        count: usize,
     );
 
     // ========================================================================
@@ -432,6 +642,12 @@ extern "C" {
         entity_id: i32,
         matrix4x4: *const f32,
     );
+    pub fn filament_transform_manager_set_transforms(
+        tm: *mut TransformManager,
+        entity_ids: *const i32,
+        matrices4x4: *const f32,
+        count: usize,
+    );
 
     // ========================================================================
     // gltfio
@@ -440,6 +656,11 @@ extern "C" {
         engine: *mut Engine,
         optimize: bool,
     ) -> *mut MaterialProvider;
+    pub fn filament_gltfio_create_ubershader_provider(
+        engine: *mut Engine,
+        archive: *const u8,
+        size: u32,
+    ) -> *mut MaterialProvider;
     pub fn filament_gltfio_material_provider_destroy_materials(provider: *mut MaterialProvider);
     pub fn filament_gltfio_destroy_material_provider(provider: *mut MaterialProvider);
 
@@ -454,6 +675,15 @@ extern "C" {
         data: *const u8,
         size: u32,
     ) -> *mut FilamentAsset;
+    pub fn filament_gltfio_asset_loader_create_instanced_asset(
+        loader: *mut AssetLoader,
+        data: *const u8,
+        size: u32,
+    ) -> *mut FilamentAsset;
+    pub fn filament_gltfio_asset_loader_create_instance(
+        loader: *mut AssetLoader,
+        asset: *mut FilamentAsset,
+    ) -> *mut FilamentInstance;
     pub fn filament_gltfio_asset_loader_destroy_asset(
         loader: *mut AssetLoader,
         asset: *mut FilamentAsset,
@@ -465,10 +695,34 @@ extern "C" {
         normalize_skinning_weights: bool,
     ) -> *mut ResourceLoader;
     pub fn filament_gltfio_resource_loader_destroy(loader: *mut ResourceLoader);
+    pub fn filament_gltfio_resource_loader_set_configuration(
+        loader: *mut ResourceLoader,
+        engine: *mut Engine,
+        gltf_path: *const c_char,
+        normalize_skinning_weights: bool,
+    );
+    pub fn filament_gltfio_resource_loader_evict_resource_data(loader: *mut ResourceLoader);
+    pub fn filament_gltfio_resource_loader_add_resource_data(
+        loader: *mut ResourceLoader,
+        uri: *const c_char,
+        data: *const c_void,
+        size: usize,
+        release: BufferReleaseCallback,
+        user: *mut c_void,
+    );
     pub fn filament_gltfio_resource_loader_load_resources(
         loader: *mut ResourceLoader,
         asset: *mut FilamentAsset,
     ) -> bool;
+    pub fn filament_gltfio_resource_loader_async_begin_load(
+        loader: *mut ResourceLoader,
+        asset: *mut FilamentAsset,
+    ) -> bool;
+    pub fn filament_gltfio_resource_loader_async_update_load(loader: *mut ResourceLoader);
+    pub fn filament_gltfio_resource_loader_async_get_load_progress(
+        loader: *mut ResourceLoader,
+    ) -> f32;
+    pub fn filament_gltfio_resource_loader_async_cancel_load(loader: *mut ResourceLoader);
     pub fn filament_gltfio_resource_loader_add_texture_provider(
         loader: *mut ResourceLoader,
         mime_type: *const c_char,
@@ -478,12 +732,54 @@ extern "C" {
     pub fn filament_gltfio_create_stb_texture_provider(
         engine: *mut Engine,
     ) -> *mut TextureProvider;
+    pub fn filament_gltfio_create_ktx2_texture_provider(
+        engine: *mut Engine,
+    ) -> *mut TextureProvider;
+    pub fn filament_gltfio_create_parallel_texture_provider(
+        engine: *mut Engine,
+        worker_count: u32,
+        max_resident: u32,
+    ) -> *mut TextureProvider;
+    pub fn filament_gltfio_parallel_texture_provider_get_stats(
+        provider: *mut TextureProvider,
+        out_stats: *mut TextureDecodeStatsC,
+    );
+    pub fn filament_gltfio_texture_provider_push(
+        provider: *mut TextureProvider,
+        data: *const u8,
+        size: usize,
+        mime_type: *const c_char,
+        flags: u64,
+    ) -> *mut Texture;
+    pub fn filament_gltfio_texture_provider_pop(provider: *mut TextureProvider) -> *mut Texture;
+    pub fn filament_gltfio_texture_provider_wait(provider: *mut TextureProvider);
+    pub fn filament_gltfio_texture_provider_cancel(provider: *mut TextureProvider);
+    pub fn filament_gltfio_texture_provider_get_counts(
+        provider: *mut TextureProvider,
+        out_pushed: *mut usize,
+        out_popped: *mut usize,
+        out_decoded: *mut usize,
+    );
     pub fn filament_gltfio_destroy_texture_provider(provider: *mut TextureProvider);
 
+    pub fn filament_meshopt_decode_buffer_view(
+        mode: u32,
+        filter: u32,
+        count: usize,
+        stride: usize,
+        src: *const u8,
+        src_size: usize,
+        dst: *mut u8,
+    ) -> bool;
+
     pub fn filament_gltfio_asset_add_entities_to_scene(
         asset: *mut FilamentAsset,
         scene: *mut Scene,
     );
+    pub fn filament_gltfio_asset_remove_entities_from_scene(
+        asset: *mut FilamentAsset,
+        scene: *mut Scene,
+    );
     pub fn filament_gltfio_asset_release_source_data(asset: *mut FilamentAsset);
     pub fn filament_gltfio_asset_get_bounding_box(
         asset: *mut FilamentAsset,
@@ -492,6 +788,22 @@ extern "C" {
     );
     pub fn filament_gltfio_asset_get_root(asset: *mut FilamentAsset) -> i32;
     pub fn filament_gltfio_asset_get_instance(asset: *mut FilamentAsset) -> *mut FilamentInstance;
+    pub fn filament_gltfio_instance_get_root(instance: *mut FilamentInstance) -> i32;
+    pub fn filament_gltfio_instance_add_entities_to_scene(
+        instance: *mut FilamentInstance,
+        scene: *mut Scene,
+    );
+    pub fn filament_gltfio_instance_remove_entities_from_scene(
+        instance: *mut FilamentInstance,
+        scene: *mut Scene,
+    );
+    pub fn filament_gltfio_instance_get_entity_count(instance: *mut FilamentInstance) -> i32;
+    pub fn filament_gltfio_instance_get_renderable_entities(
+        engine: *mut Engine,
+        instance: *mut FilamentInstance,
+        out_entities: *mut i32,
+        max_count: i32,
+    ) -> i32;
     pub fn filament_gltfio_instance_get_material_instance_count(
         instance: *mut FilamentInstance,
     ) -> i32;
@@ -653,6 +965,16 @@ extern "C" {
         pixels: *const u8,
         pixel_count_rgba8: u32,
     ) -> bool;
+    pub fn filament_texture_set_image_rgba8_owned(
+        engine: *mut Engine,
+        texture: *mut Texture,
+        width: u32,
+        height: u32,
+        pixels: *mut c_void,
+        size: usize,
+        release: BufferReleaseCallback,
+        user: *mut c_void,
+    ) -> bool;
 
     pub fn filament_render_target_create(
         engine: *mut Engine,
@@ -681,6 +1003,24 @@ extern "C" {
         buffer_size: u32,
     ) -> bool;
 
+    pub fn filament_async_readback_create(capacity_bytes: u32) -> *mut AsyncReadback;
+    pub fn filament_async_readback_destroy(readback: *mut AsyncReadback);
+    pub fn filament_async_readback_is_busy(readback: *const AsyncReadback) -> bool;
+    pub fn filament_async_readback_poll(
+        readback: *mut AsyncReadback,
+        out_buffer: *mut u8,
+        buffer_size: u32,
+    ) -> u32;
+    pub fn filament_renderer_read_pixels_async(
+        renderer: *mut Renderer,
+        render_target: *mut RenderTarget,
+        x: u32,
+        y: u32,
+        width: u32,
+        height: u32,
+        readback: *mut AsyncReadback,
+    ) -> bool;
+
     pub fn filament_renderer_read_pixels_swap_chain(
         renderer: *mut Renderer,
         x: u32,
@@ -719,6 +1059,23 @@ extern "C" {
         values: u8,
     );
 
+    // ========================================================================
+    // RenderableManager - batched material override set
+    // ========================================================================
+
+    pub fn filament_material_override_set_create(
+        engine: *mut Engine,
+    ) -> *mut MaterialOverrideSet;
+    pub fn filament_material_override_set_destroy(set: *mut MaterialOverrideSet);
+    pub fn filament_material_override_set_push(
+        set: *mut MaterialOverrideSet,
+        entity_ids: *const i32,
+        instances: *const *mut MaterialInstance,
+        layer_values: *const u8,
+        count: usize,
+    ) -> i32;
+    pub fn filament_material_override_set_pop(set: *mut MaterialOverrideSet);
+
     // ========================================================================
     // gltfio - entity enumeration
     // ========================================================================
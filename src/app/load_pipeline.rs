@@ -0,0 +1,327 @@
+//! Staged scene loading.
+//!
+//! Work that does not touch the engine (glTF mapping, JSON parsing and
+//! meshopt decode, texture cache lookups and KTX reads) runs on a worker pool.
+//! The engine thread then creates Filament objects from the prepared results;
+//! Basis KTX2 textures go back to the pool for transcoding in between.
+//! Every step is recorded as a span on a shared timeline.
+
+use super::{resolve_path_for_read, resolve_runtime_texture_cache, TextureCompression};
+use crate::assets::{AssetManager, PreparedGltf};
+use crate::filament::Ktx2Transcode;
+use crate::scene::{MaterialTextureBindingData, TextureColorSpace};
+use serde::Serialize;
+use std::collections::HashMap;
+use std::sync::Mutex;
+use std::time::{Duration, Instant};
+
+/// One unit of pool work; callers submit one job per distinct file.
+pub enum PrepareJob {
+    Gltf {
+        path: String,
+    },
+    Texture {
+        key: String,
+        runtime_path: Option<String>,
+        source_path: String,
+        color_space: TextureColorSpace,
+        compression: TextureCompression,
+    },
+}
+
+impl PrepareJob {
+    pub fn texture(binding: &MaterialTextureBindingData, compression: TextureCompression) -> Self {
+        Self::Texture {
+            key: texture_key(binding),
+            runtime_path: binding.runtime_ktx_path.clone(),
+            source_path: binding.source_path.clone(),
+            color_space: binding.color_space,
+            compression,
+        }
+    }
+
+    fn label(&self) -> &str {
+        match self {
+            Self::Gltf { path } => path,
+            Self::Texture { key, .. } => key,
+        }
+    }
+
+    fn stage(&self) -> &'static str {
+        match self {
+            Self::Gltf { .. } => "prepare-gltf",
+            Self::Texture { .. } => "prepare-texture",
+        }
+    }
+}
+
+/// Key under which a binding's prepared KTX bytes are stored.
+pub fn texture_key(binding: &MaterialTextureBindingData) -> String {
+    binding
+        .runtime_ktx_path
+        .clone()
+        .unwrap_or_else(|| binding.source_path.clone())
+}
+
+enum Prepared {
+    Gltf(PreparedGltf),
+    Texture(String, Result<Vec<u8>, String>),
+}
+
+/// Pool output, ready for the engine thread.
+#[derive(Default)]
+pub struct PreparedScene {
+    pub gltf: Vec<PreparedGltf>,
+    /// KTX bytes keyed by `texture_key`.
+    pub textures: HashMap<String, Result<Vec<u8>, String>>,
+}
+
+#[derive(Debug, Clone, Serialize)]
+pub struct LoadSpan {
+    pub stage: &'static str,
+    pub label: String,
+    /// Pool worker index; `None` for the engine thread.
+    pub worker: Option<usize>,
+    pub start_ms: f64,
+    pub end_ms: f64,
+}
+
+/// Timeline of one scene load, relative to the start of the load.
+#[derive(Debug, Clone, Default, Serialize)]
+pub struct LoadTimeline {
+    pub workers: usize,
+    pub jobs: usize,
+    /// Wall time of the pool stage.
+    pub prepare_ms: f64,
+    /// Wall time of the pool's KTX2 transcode stage.
+    pub transcode_ms: f64,
+    /// Wall time spent creating engine objects.
+    pub create_ms: f64,
+    pub total_ms: f64,
+    pub spans: Vec<LoadSpan>,
+}
+
+pub struct LoadPipeline {
+    started: Instant,
+    timeline: LoadTimeline,
+}
+
+impl LoadPipeline {
+    pub fn new() -> Self {
+        Self {
+            started: Instant::now(),
+            timeline: LoadTimeline::default(),
+        }
+    }
+
+    /// Run `jobs` on a worker pool sized to the machine and wait for them.
+    pub fn prepare(&mut self, jobs: Vec<PrepareJob>) -> PreparedScene {
+        let mut prepared = PreparedScene::default();
+        self.timeline.jobs = jobs.len();
+        if jobs.is_empty() {
+            return prepared;
+        }
+        let stage_start = Instant::now();
+        let results = self.run_pool(jobs, |job| {
+            let output = run_job(&job);
+            (output, job.stage(), job.label().to_string())
+        });
+        self.timeline.prepare_ms = ms(stage_start.elapsed());
+
+        for output in results {
+            match output {
+                Prepared::Gltf(gltf) => prepared.gltf.push(gltf),
+                Prepared::Texture(key, bytes) => {
+                    prepared.textures.insert(key, bytes);
+                }
+            }
+        }
+        prepared
+    }
+
+    /// Transcode KTX2 textures started on the engine thread, keyed like
+    /// `PreparedScene::textures`. Failed transcodes are logged and dropped
+    /// here, back on the engine thread.
+    pub fn transcode(
+        &mut self,
+        transcodes: Vec<(String, Ktx2Transcode)>,
+    ) -> HashMap<String, Ktx2Transcode> {
+        if transcodes.is_empty() {
+            return HashMap::new();
+        }
+        let stage_start = Instant::now();
+        let results = self.run_pool(transcodes, |(key, mut transcode)| {
+            let ok = transcode.transcode();
+            ((key.clone(), transcode, ok), "transcode-texture", key)
+        });
+        self.timeline.transcode_ms = ms(stage_start.elapsed());
+
+        results
+            .into_iter()
+            .filter_map(|(key, transcode, ok)| {
+                if !ok {
+                    log::warn!("Failed transcoding KTX2 texture '{}'", key);
+                }
+                ok.then_some((key, transcode))
+            })
+            .collect()
+    }
+
+    /// Hand `jobs` out to scoped workers and record a span per job. `run`
+    /// returns the job's output with its span stage and label.
+    fn run_pool<J: Send, R: Send>(
+        &mut self,
+        jobs: Vec<J>,
+        run: impl Fn(J) -> (R, &'static str, String) + Sync,
+    ) -> Vec<R> {
+        let workers = std::thread::available_parallelism()
+            .map(|count| count.get())
+            .unwrap_or(1)
+            .min(jobs.len())
+            .max(1);
+        self.timeline.workers = self.timeline.workers.max(workers);
+        let started = self.started;
+        let queue = Mutex::new(jobs.into_iter());
+        let results: Vec<(R, LoadSpan)> = std::thread::scope(|scope| {
+            let handles: Vec<_> = (0..workers)
+                .map(|worker| {
+                    let queue = &queue;
+                    let run = &run;
+                    scope.spawn(move || {
+                        let mut done = Vec::new();
+                        loop {
+                            let Some(job) = queue.lock().unwrap().next() else {
+                                break;
+                            };
+                            let start = started.elapsed();
+                            let (output, stage, label) = run(job);
+                            done.push((output, span(stage, &label, Some(worker), start, started)));
+                        }
+                        done
+                    })
+                })
+                .collect();
+            handles
+                .into_iter()
+                .flat_map(|handle| handle.join().expect("scene load worker panicked"))
+                .collect()
+        });
+        results
+            .into_iter()
+            .map(|(output, span)| {
+                self.timeline.spans.push(span);
+                output
+            })
+            .collect()
+    }
+
+    /// Run one engine-thread step and record it on the timeline.
+    pub fn record<T>(&mut self, stage: &'static str, label: &str, step: impl FnOnce() -> T) -> T {
+        let start = self.started.elapsed();
+        let result = step();
+        let span = span(stage, label, None, start, self.started);
+        self.timeline.create_ms += span.end_ms - span.start_ms;
+        self.timeline.spans.push(span);
+        result
+    }
+
+    pub fn finish(mut self) -> LoadTimeline {
+        self.timeline.total_ms = ms(self.started.elapsed());
+        self.timeline
+            .spans
+            .sort_by(|a, b| a.start_ms.total_cmp(&b.start_ms));
+        self.timeline
+    }
+}
+
+fn run_job(job: &PrepareJob) -> Prepared {
+    match job {
+        PrepareJob::Gltf { path } => Prepared::Gltf(AssetManager::prepare_gltf(path)),
+        PrepareJob::Texture {
+            key,
+            runtime_path,
+            source_path,
+            color_space,
+            compression,
+        } => Prepared::Texture(
+            key.clone(),
+            read_texture(
+                runtime_path.as_deref(),
+                source_path,
+                *color_space,
+                *compression,
+            ),
+        ),
+    }
+}
+
+/// Read a binding's cached KTX, rebuilding the cache entry from the source
+/// image when it is missing.
+fn read_texture(
+    runtime_path: Option<&str>,
+    source_path: &str,
+    color_space: TextureColorSpace,
+    compression: TextureCompression,
+) -> Result<Vec<u8>, String> {
+    let cached = runtime_path.and_then(|path| resolve_path_for_read(path).ok());
+    let path = match cached {
+        Some(path) => path,
+        None => {
+            let (runtime_path, _) =
+                resolve_runtime_texture_cache(source_path, color_space, compression)?;
+            resolve_path_for_read(&runtime_path)?
+        }
+    };
+    std::fs::read(&path).map_err(|err| format!("Failed reading '{}': {}", path.display(), err))
+}
+
+fn span(
+    stage: &'static str,
+    label: &str,
+    worker: Option<usize>,
+    start: Duration,
+    origin: Instant,
+) -> LoadSpan {
+    LoadSpan {
+        stage,
+        label: label.to_string(),
+        worker,
+        start_ms: ms(start),
+        end_ms: ms(origin.elapsed()),
+    }
+}
+
+fn ms(value: Duration) -> f64 {
+    value.as_secs_f64() * 1000.0
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn records_pool_and_engine_spans() {
+        let mut pipeline = LoadPipeline::new();
+        let missing = "assets/__missing_texture__.ktx".to_string();
+        let prepared = pipeline.prepare(vec![PrepareJob::Texture {
+            key: missing.clone(),
+            runtime_path: Some(missing.clone()),
+            source_path: missing.clone(),
+            color_space: TextureColorSpace::Srgb,
+            compression: TextureCompression::None,
+        }]);
+        assert!(matches!(prepared.textures.get(&missing), Some(Err(_))));
+        assert_eq!(pipeline.record("create-asset", "a", || 7), 7);
+
+        let timeline = pipeline.finish();
+        assert_eq!((timeline.jobs, timeline.workers), (1, 1));
+        assert_eq!(timeline.spans.len(), 2);
+        assert_eq!(timeline.spans[0].worker, Some(0));
+        assert_eq!(timeline.spans[1].worker, None);
+        assert!(timeline
+            .spans
+            .iter()
+            .all(|span| span.end_ms >= span.start_ms));
+        assert!(timeline.total_ms >= timeline.spans[1].end_ms);
+    }
+}
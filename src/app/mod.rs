@@ -1,28 +1,39 @@
 mod egui_host;
 mod input;
+mod load_pipeline;
 mod timing;
 
-use crate::assets::AssetManager;
+use crate::assets::{
+    AssetLoadStats, AssetLoadTimings, AssetManager, LoadedAsset, MaterialProviderKind,
+};
 use crate::filament::{
-    Entity, LightParams as FilamentLightParams, LightShadowOptions as FilamentLightShadowOptions,
-    LightType as FilamentLightType,
+    EngineConfig, Entity, Ktx2Transcode, LightParams as FilamentLightParams,
+    LightShadowOptions as FilamentLightShadowOptions, LightType as FilamentLightType,
+    ProgramCacheStats, StagingRingStats, TextureDecodeStats,
+};
+use crate::render::{
+    CameraController, CameraMovement, EngineConfigOverrides, EnginePreset, PickBackend,
+    PickReadbackMode, PickStats, RenderContext, RenderError,
 };
-use crate::render::{CameraController, CameraMovement, RenderContext, RenderError};
+use crate::scene::serialization::BINARY_SCENE_EXTENSION;
 use crate::scene::{
     compose_transform_matrix, DirectionalLightData, EnvironmentData, LightData, LightType,
-    MaterialOverrideData, MaterialTextureBindingData, MediaSourceKind, RuntimeObject,
+    MaterialOverrideData, MaterialTextureBindingData, MediaSourceKind, RuntimeKind, RuntimeObject,
     SceneObjectKind, SceneRuntime, SceneState, TextureColorSpace,
 };
 use crate::ui::{MaterialParams, UiState, MATERIAL_TEXTURE_PARAMS};
 use glam::{EulerRot, Mat3, Vec2, Vec3};
 use input::InputState;
+use load_pipeline::{LoadPipeline, LoadTimeline, PrepareJob};
 use serde::Serialize;
 use sha2::{Digest, Sha256};
 use timing::FrameTiming;
 
+use std::collections::{HashMap, HashSet};
 use std::ffi::CString;
 use std::path::PathBuf;
 use std::process::Command;
+use std::sync::atomic::{AtomicU64, Ordering};
 use std::sync::Arc;
 use std::time::{Duration, Instant};
 use winit::application::ApplicationHandler;
@@ -129,6 +140,51 @@ impl UiBackend {
     }
 }
 
+/// Block compression for cached runtime textures. The Basis modes write KTX2
+/// that is transcoded at load to whatever block format the backend samples.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum TextureCompression {
+    /// Uncompressed mipmapped KTX1 from mipgen.
+    None,
+    /// Basis ETC1S: smallest files, suited to color maps.
+    Etc1s,
+    /// Basis UASTC: higher quality, suited to normal and data maps.
+    Uastc,
+    /// ETC1S for sRGB textures, UASTC for linear ones.
+    Auto,
+}
+
+impl TextureCompression {
+    fn from_str(value: &str) -> Option<Self> {
+        match value.trim().to_ascii_lowercase().as_str() {
+            "none" | "off" => Some(Self::None),
+            "etc1s" => Some(Self::Etc1s),
+            "uastc" => Some(Self::Uastc),
+            "auto" => Some(Self::Auto),
+            _ => None,
+        }
+    }
+
+    fn as_str(self) -> &'static str {
+        match self {
+            Self::None => "none",
+            Self::Etc1s => "etc1s",
+            Self::Uastc => "uastc",
+            Self::Auto => "auto",
+        }
+    }
+
+    /// The concrete mode for a texture, or `None` for uncompressed KTX1.
+    fn resolve(self, color_space: TextureColorSpace) -> Option<Self> {
+        match (self, color_space) {
+            (Self::None, _) => None,
+            (Self::Auto, TextureColorSpace::Srgb) => Some(Self::Etc1s),
+            (Self::Auto, TextureColorSpace::Linear) => Some(Self::Uastc),
+            (mode, _) => Some(mode),
+        }
+    }
+}
+
 const GIZMO_NONE: i32 = 0;
 const GIZMO_TRANSLATE_X: i32 = 1;
 const GIZMO_TRANSLATE_Y: i32 = 2;
@@ -149,6 +205,9 @@ const GIZMO_SCALE_XY: i32 = 24;
 const GIZMO_SCALE_XZ: i32 = 25;
 const GIZMO_SCALE_YZ: i32 = 26;
 const GIZMO_SCALE_UNIFORM: i32 = 27;
+// Left-button drags in Select mode longer than this (in pixels) become a
+// marquee region pick instead of a click pick.
+const MARQUEE_MIN_DRAG_PX: f32 = 4.0;
 const GIZMO_BASE_DISTANCE_FACTOR: f32 = 0.18;
 const GIZMO_BASE_MIN_WORLD_LEN: f32 = 0.15;
 const GIZMO_GLOBAL_SCALE: f32 = 0.5;
@@ -215,6 +274,7 @@ enum CommandError {
 struct HarnessConfig {
     import_path: String,
     extra_import_paths: Vec<String>,
+    scene_path: Option<PathBuf>,
     screenshot_path: Option<PathBuf>,
     report_path: Option<PathBuf>,
     settle_frames: u32,
@@ -252,8 +312,14 @@ struct HarnessState {
     setup_success: bool,
     setup_error: Option<String>,
     import_attempted: bool,
+    import_pending: bool,
     import_success: bool,
     import_error: Option<String>,
+    asset_loads: Vec<HarnessAssetLoadReport>,
+    scene_loads: Vec<LoadTimeline>,
+    import_started: Option<Instant>,
+    material_warmup: Option<HarnessMaterialWarmupReport>,
+    time_to_first_stable_frame_ms: Option<f64>,
     screenshot_attempted: bool,
     screenshot_success: bool,
     screenshot_error: Option<String>,
@@ -275,12 +341,163 @@ struct HarnessReport {
     start_minimized: bool,
     import_path: String,
     extra_import_paths: Vec<String>,
+    scene_path: Option<String>,
     frame_count: u32,
     import_success: bool,
     import_error: Option<String>,
+    asset_loads: Vec<HarnessAssetLoadReport>,
+    scene_loads: Vec<LoadTimeline>,
+    material_warmup: Option<HarnessMaterialWarmupReport>,
+    time_to_first_stable_frame_ms: Option<f64>,
     screenshot_path: Option<String>,
     screenshot_success: bool,
     screenshot_error: Option<String>,
+    staging_ring: Option<HarnessStagingRingReport>,
+    pick: Option<HarnessPickReport>,
+    engine_config: Option<EngineConfig>,
+    material_provider: Option<String>,
+    program_cache: Option<HarnessProgramCacheReport>,
+    texture_decode: Option<HarnessTextureDecodeReport>,
+}
+
+#[derive(Debug, Clone, Serialize)]
+struct HarnessAssetLoadReport {
+    path: String,
+    load_ms: f64,
+    loader_setup_ms: f64,
+    read_ms: f64,
+    parse_ms: f64,
+    resources_ms: f64,
+    finalize_ms: f64,
+    instanced: bool,
+    frames: u32,
+    progress: f32,
+}
+
+impl HarnessAssetLoadReport {
+    fn new(path: String, asset: &LoadedAsset, stats: AssetLoadStats) -> Self {
+        let timings = &asset.timings;
+        let ms = |value: Duration| value.as_secs_f64() * 1000.0;
+        Self {
+            path,
+            load_ms: ms(timings.total()),
+            loader_setup_ms: ms(timings.loader_setup),
+            read_ms: ms(timings.read),
+            parse_ms: ms(timings.parse),
+            resources_ms: ms(timings.resources),
+            finalize_ms: ms(timings.finalize),
+            instanced: asset.instanced,
+            frames: stats.frames,
+            progress: stats.progress,
+        }
+    }
+}
+
+#[derive(Debug, Clone, Copy, Serialize)]
+struct HarnessMaterialWarmupReport {
+    materials: u32,
+    compile_ms: f64,
+}
+
+#[derive(Debug, Serialize)]
+struct HarnessStagingRingReport {
+    frame_count: u32,
+    bytes_per_frame: u64,
+    frames_advanced: u64,
+    last_frame_bytes: u64,
+    peak_frame_bytes: u64,
+    total_bytes: u64,
+    stalls: u64,
+    overflow_uploads: u64,
+}
+
+impl From<StagingRingStats> for HarnessStagingRingReport {
+    fn from(stats: StagingRingStats) -> Self {
+        Self {
+            frame_count: stats.frame_count,
+            bytes_per_frame: stats.bytes_per_frame,
+            frames_advanced: stats.frames_advanced,
+            last_frame_bytes: stats.last_frame_bytes,
+            peak_frame_bytes: stats.peak_frame_bytes,
+            total_bytes: stats.total_bytes,
+            stalls: stats.stalls,
+            overflow_uploads: stats.overflow_uploads,
+        }
+    }
+}
+
+#[derive(Debug, Serialize)]
+struct HarnessProgramCacheReport {
+    hits: u64,
+    misses: u64,
+    stores: u64,
+    bytes_read: u64,
+    bytes_written: u64,
+}
+
+impl From<ProgramCacheStats> for HarnessProgramCacheReport {
+    fn from(stats: ProgramCacheStats) -> Self {
+        Self {
+            hits: stats.hits,
+            misses: stats.misses,
+            stores: stats.stores,
+            bytes_read: stats.bytes_read,
+            bytes_written: stats.bytes_written,
+        }
+    }
+}
+
+#[derive(Debug, Serialize)]
+struct HarnessTextureDecodeReport {
+    worker_count: u32,
+    max_resident: u32,
+    peak_resident: u32,
+    textures_decoded: u64,
+    textures_failed: u64,
+    encoded_mb: f64,
+    decoded_mb: f64,
+    /// Decode time summed over workers.
+    decode_ms: f64,
+    /// Wall time with textures outstanding.
+    busy_ms: f64,
+    decoded_mb_per_s: f64,
+    textures_per_s: f64,
+}
+
+impl From<TextureDecodeStats> for HarnessTextureDecodeReport {
+    fn from(stats: TextureDecodeStats) -> Self {
+        let mb = |bytes: u64| bytes as f64 / (1024.0 * 1024.0);
+        let busy_s = stats.busy_ns as f64 / 1e9;
+        let per_s = |value: f64| if busy_s > 0.0 { value / busy_s } else { 0.0 };
+        Self {
+            worker_count: stats.worker_count,
+            max_resident: stats.max_resident,
+            peak_resident: stats.peak_resident,
+            textures_decoded: stats.textures_decoded,
+            textures_failed: stats.textures_failed,
+            encoded_mb: mb(stats.encoded_bytes),
+            decoded_mb: mb(stats.decoded_bytes),
+            decode_ms: stats.decode_ns as f64 / 1e6,
+            busy_ms: stats.busy_ns as f64 / 1e6,
+            decoded_mb_per_s: per_s(mb(stats.decoded_bytes)),
+            textures_per_s: per_s(stats.textures_decoded as f64),
+        }
+    }
+}
+
+#[derive(Debug, Serialize)]
+struct HarnessPickReport {
+    id_pass_renders: u64,
+    id_pass_reuses: u64,
+}
+
+impl From<PickStats> for HarnessPickReport {
+    fn from(stats: PickStats) -> Self {
+        Self {
+            id_pass_renders: stats.id_pass_renders,
+            id_pass_reuses: stats.id_pass_reuses,
+        }
+    }
 }
 
 impl HarnessState {
@@ -296,8 +513,14 @@ impl HarnessState {
             setup_success: false,
             setup_error: None,
             import_attempted: false,
+            import_pending: false,
             import_success: false,
             import_error: None,
+            asset_loads: Vec::new(),
+            scene_loads: Vec::new(),
+            import_started: None,
+            material_warmup: None,
+            time_to_first_stable_frame_ms: None,
             screenshot_attempted: false,
             screenshot_success: false,
             screenshot_error: None,
@@ -320,9 +543,18 @@ impl HarnessState {
             start_minimized: self.config.start_minimized,
             import_path: self.config.import_path.clone(),
             extra_import_paths: self.config.extra_import_paths.clone(),
+            scene_path: self
+                .config
+                .scene_path
+                .as_ref()
+                .map(|path| path.display().to_string()),
             frame_count: self.frame_count,
             import_success: self.import_success,
             import_error: self.import_error.clone(),
+            asset_loads: self.asset_loads.clone(),
+            scene_loads: self.scene_loads.clone(),
+            material_warmup: self.material_warmup,
+            time_to_first_stable_frame_ms: self.time_to_first_stable_frame_ms,
             screenshot_path: self
                 .config
                 .screenshot_path
@@ -334,6 +566,12 @@ impl HarnessState {
                 true
             },
             screenshot_error: self.screenshot_error.clone(),
+            staging_ring: None,
+            pick: None,
+            engine_config: None,
+            material_provider: None,
+            program_cache: None,
+            texture_decode: None,
         }
     }
 }
@@ -356,7 +594,13 @@ pub struct App {
     mouse_pos: Option<(f32, f32)>,
     mouse_buttons: [bool; 5],
     pending_click_select: bool,
+    marquee_anchor: Option<(f32, f32)>,
     pending_pick_request: Option<PickRequestKind>,
+    pick_readback_mode: PickReadbackMode,
+    pick_backend: PickBackend,
+    engine_config: EngineConfig,
+    program_cache_enabled: bool,
+    texture_compression: TextureCompression,
     camera_drag_mode: Option<CameraDragMode>,
     camera_control_profile: CameraControlProfile,
     transform_tool_mode: TransformToolMode,
@@ -411,7 +655,13 @@ impl App {
             mouse_pos: None,
             mouse_buttons: [false; 5],
             pending_click_select: false,
+            marquee_anchor: None,
             pending_pick_request: None,
+            pick_readback_mode: PickReadbackMode::Async,
+            pick_backend: PickBackend::ViewPick,
+            engine_config: EngineConfig::default(),
+            program_cache_enabled: true,
+            texture_compression: TextureCompression::Auto,
             camera_drag_mode: None,
             camera_control_profile: CameraControlProfile::Blender,
             transform_tool_mode: TransformToolMode::Select,
@@ -431,8 +681,23 @@ impl App {
         }
     }
 
+    fn apply_hover_pick_hit(&mut self, hit: crate::render::PickHit) {
+        if hit.is_none() {
+            self.gizmo_hover_axis = GIZMO_NONE;
+        } else if matches!(
+            hit.key.kind,
+            crate::render::PickKind::GizmoAxis
+                | crate::render::PickKind::GizmoPlane
+                | crate::render::PickKind::GizmoRing
+        ) {
+            self.gizmo_hover_axis = hit.key.sub_id as i32;
+        }
+    }
+
     fn init_filament(&mut self, window: &Window) -> Result<(), RenderError> {
-        let mut render = RenderContext::new(window)?;
+        let program_cache_dir = self.program_cache_enabled.then(program_cache_dir);
+        let mut render =
+            RenderContext::new(window, &self.engine_config, program_cache_dir.as_deref())?;
 
         // Start with empty scene - no default objects
         self.camera = CameraController::new([0.0, 0.0, 5.0], 0.0, 0.0);
@@ -446,6 +711,8 @@ impl App {
             render.set_ui_enabled(false);
             render.init_egui_overlay(window)?;
         }
+        render.set_pick_readback_mode(self.pick_readback_mode);
+        render.set_pick_backend(self.pick_backend);
 
         self.render = Some(render);
         Ok(())
@@ -1097,11 +1364,27 @@ impl App {
     }
 
     fn current_selection_index(&self) -> Option<usize> {
-        let selection_id = self.selection_id?;
-        self.scene
-            .objects()
-            .iter()
-            .position(|object| object.id == selection_id)
+        self.scene_index_of(self.selection_id?)
+    }
+
+    /// Scene index of `object_id`. Runtime slots mirror scene order once
+    /// reconciled; between an edit and the next reconcile this falls back to
+    /// a scan.
+    fn scene_index_of(&self, object_id: u64) -> Option<usize> {
+        self.scene_runtime
+            .slot_of(object_id)
+            .filter(|&index| {
+                self.scene
+                    .objects()
+                    .get(index)
+                    .is_some_and(|object| object.id == object_id)
+            })
+            .or_else(|| {
+                self.scene
+                    .objects()
+                    .iter()
+                    .position(|object| object.id == object_id)
+            })
     }
 
     fn set_selection_from_index(&mut self, index: Option<usize>) {
@@ -1113,6 +1396,9 @@ impl App {
         let frame_start = Instant::now();
         // Run harness actions before the main render pass so screenshot capture
         // does not compete with a second begin_frame call later in the same tick.
+        self.collect_retired_assets();
+        self.pump_asset_loads();
+        self.poll_material_warmup();
         self.run_harness_step();
         self.ui
             .update(&self.scene, &self.scene_runtime, &self.assets);
@@ -1181,10 +1467,7 @@ impl App {
                         light_settings.shadow_far_hint = data.shadow.far_hint;
                         light_settings.light_type = scene_light_type_to_ui(data.light_type);
                         original_light_data = Some(data.clone());
-                        selected_light_entity = self
-                            .scene_runtime
-                            .get(selected)
-                            .and_then(|runtime| runtime.root_entity);
+                        selected_light_entity = self.scene_runtime.root_entity(selected);
                         1
                     }
                     SceneObjectKind::DirectionalLight(data) => {
@@ -1210,10 +1493,7 @@ impl App {
                         light_settings.shadow_far_hint = migrated.shadow.far_hint;
                         light_settings.light_type = scene_light_type_to_ui(migrated.light_type);
                         original_light_data = Some(migrated);
-                        selected_light_entity = self
-                            .scene_runtime
-                            .get(selected)
-                            .and_then(|runtime| runtime.root_entity);
+                        selected_light_entity = self.scene_runtime.root_entity(selected);
                         1
                     }
                     SceneObjectKind::Environment(data) => {
@@ -1232,36 +1512,32 @@ impl App {
         if let Some(selected) =
             Self::normalize_selection(selected_index, self.scene.objects().len())
         {
-            if let Some(object) = self.scene.objects().get(selected) {
-                let world = match &object.kind {
-                    SceneObjectKind::Asset(data) => data.position,
-                    SceneObjectKind::Light(data) => data.position,
-                    SceneObjectKind::DirectionalLight(_) => [0.0, 0.0, 0.0],
-                    SceneObjectKind::Environment(_) => self.orbit_pivot,
-                };
-                gizmo_origin_world_xyz = world;
-                if let Some(center_screen) = self.world_to_screen(world) {
-                    gizmo_screen_points_xy[0] = center_screen[0];
-                    gizmo_screen_points_xy[1] = center_screen[1];
-                    let axis_world_len = self.gizmo_axis_world_length(world);
-                    gizmo_axis_world_len = axis_world_len;
-                    let x_world = [world[0] + axis_world_len, world[1], world[2]];
-                    let y_world = [world[0], world[1] + axis_world_len, world[2]];
-                    let z_world = [world[0], world[1], world[2] + axis_world_len];
-                    if let Some(p) = self.world_to_screen(x_world) {
-                        gizmo_screen_points_xy[2] = p[0];
-                        gizmo_screen_points_xy[3] = p[1];
-                    }
-                    if let Some(p) = self.world_to_screen(y_world) {
-                        gizmo_screen_points_xy[4] = p[0];
-                        gizmo_screen_points_xy[5] = p[1];
-                    }
-                    if let Some(p) = self.world_to_screen(z_world) {
-                        gizmo_screen_points_xy[6] = p[0];
-                        gizmo_screen_points_xy[7] = p[1];
-                    }
-                    gizmo_visible = true;
+            let world = self
+                .scene_runtime
+                .origin(selected)
+                .unwrap_or(self.orbit_pivot);
+            gizmo_origin_world_xyz = world;
+            if let Some(center_screen) = self.world_to_screen(world) {
+                gizmo_screen_points_xy[0] = center_screen[0];
+                gizmo_screen_points_xy[1] = center_screen[1];
+                let axis_world_len = self.gizmo_axis_world_length(world);
+                gizmo_axis_world_len = axis_world_len;
+                let x_world = [world[0] + axis_world_len, world[1], world[2]];
+                let y_world = [world[0], world[1] + axis_world_len, world[2]];
+                let z_world = [world[0], world[1], world[2] + axis_world_len];
+                if let Some(p) = self.world_to_screen(x_world) {
+                    gizmo_screen_points_xy[2] = p[0];
+                    gizmo_screen_points_xy[3] = p[1];
+                }
+                if let Some(p) = self.world_to_screen(y_world) {
+                    gizmo_screen_points_xy[4] = p[0];
+                    gizmo_screen_points_xy[5] = p[1];
+                }
+                if let Some(p) = self.world_to_screen(z_world) {
+                    gizmo_screen_points_xy[6] = p[0];
+                    gizmo_screen_points_xy[7] = p[1];
                 }
+                gizmo_visible = true;
             }
         }
         log::debug!(
@@ -1278,25 +1554,15 @@ impl App {
         let selected_for_helpers =
             Self::normalize_selection(selected_index, self.scene.objects().len());
         let light_helper_specs: Vec<crate::render::LightHelperSpec> = self
-            .scene
-            .objects()
-            .iter()
-            .enumerate()
-            .filter_map(|(index, object)| {
-                let object_index = u32::try_from(index).ok()?;
-                let (light_type, position, direction) = match &object.kind {
-                    SceneObjectKind::Light(data) => (data.light_type, data.position, data.direction),
-                    SceneObjectKind::DirectionalLight(data) => {
-                        (LightType::Directional, [0.0, 0.0, 0.0], data.direction)
-                    }
-                    _ => return None,
-                };
+            .scene_runtime
+            .lights()
+            .filter_map(|(index, object_id, light, position)| {
                 Some(crate::render::LightHelperSpec {
-                    object_id: object.id,
-                    object_index,
-                    light_type,
+                    object_id,
+                    object_index: u32::try_from(index).ok()?,
+                    light_type: light.light_type,
                     position,
-                    direction,
+                    direction: light.direction,
                     selected: selected_for_helpers == Some(index),
                 })
             })
@@ -1379,6 +1645,8 @@ impl App {
         let mut pending_update_environment_command: Option<SceneCommand> = None;
         let mut pending_set_material_command: Option<SceneCommand> = None;
         let mut pick_hit: Option<crate::render::PickHit> = None;
+        let mut hover_pick_hit: Option<crate::render::PickHit> = None;
+        let mut region_pick_hit: Option<crate::render::PickRegionHit> = None;
         let has_active_selection = self.current_selection_index().is_some();
         let (mut hdr_path_string, mut ibl_path_string, mut skybox_path_string) = {
             let (hdr_path, ibl_path, skybox_path) = self.ui.environment_paths_mut();
@@ -1448,12 +1716,10 @@ impl App {
                             .enumerate()
                             .filter_map(|(index, obj)| {
                                 if let SceneObjectKind::Asset(_) = &obj.kind {
-                                    let loaded = self.assets.loaded_assets().iter().find(|a| {
-                                        self.scene_runtime
-                                            .get(index)
-                                            .and_then(|rt| rt.root_entity)
-                                            .map_or(false, |re| re == a.root_entity)
-                                    });
+                                    let loaded = self
+                                        .scene_runtime
+                                        .root_entity(index)
+                                        .and_then(|re| self.assets.loaded_asset(re));
                                     loaded.map(|a| {
                                         (
                                             crate::render::PickKey::scene_mesh(index as u32),
@@ -1998,6 +2264,8 @@ impl App {
 
                 // Capture GPU pick result (processed after borrow scope)
                 pick_hit = render.take_pick_hit();
+                hover_pick_hit = render.take_hover_pick_hit();
+                region_pick_hit = render.take_region_pick_hit();
             }
             (
                 buffer_to_string(hdr_path),
@@ -2005,33 +2273,25 @@ impl App {
                 buffer_to_string(skybox_path),
             )
         };
-        // Process GPU pick result (outside borrow scope)
+        // Process GPU pick result (outside borrow scope). With async readback a
+        // click resolves a few frames after its request, so the selection is
+        // applied here when it arrives; `pending_pick_request` stays set until then.
         if let Some(hit) = pick_hit {
             let pick_request = self
                 .pending_pick_request
                 .take()
                 .unwrap_or(PickRequestKind::HoverGizmo);
             log::debug!(
-                "Pick result: request={:?} hit_kind={:?} hit_object_id={} hit_sub_id={} hit_none={}",
+                "Pick result: request={:?} hit_kind={:?} hit_object_id={} hit_sub_id={} hit_none={} hit_world={:?}",
                 pick_request,
                 hit.key.kind,
                 hit.key.object_id,
                 hit.key.sub_id,
                 hit.is_none(),
+                hit.world_position,
             );
             match pick_request {
-                PickRequestKind::HoverGizmo => {
-                    if hit.is_none() {
-                        self.gizmo_hover_axis = GIZMO_NONE;
-                    } else if matches!(
-                        hit.key.kind,
-                        crate::render::PickKind::GizmoAxis
-                            | crate::render::PickKind::GizmoPlane
-                            | crate::render::PickKind::GizmoRing
-                    ) {
-                        self.gizmo_hover_axis = hit.key.sub_id as i32;
-                    }
-                }
+                PickRequestKind::HoverGizmo => self.apply_hover_pick_hit(hit),
                 PickRequestKind::Select => {
                     if hit.is_none() {
                         if self.transform_tool_mode == TransformToolMode::Select {
@@ -2070,6 +2330,31 @@ impl App {
                 }
             }
         }
+        // Async hover picks land a few frames after they were requested.
+        if let Some(hit) = hover_pick_hit {
+            if self.gizmo_drag_state.is_none() {
+                self.apply_hover_pick_hit(hit);
+            }
+        }
+        // Marquee picks select the object covering most of the rectangle.
+        if let Some(region) = region_pick_hit {
+            log::debug!(
+                "Region pick result: min={:?} max={:?} pixels={} coverage={:?}",
+                region.screen_min,
+                region.screen_max,
+                region.pixel_count,
+                region.coverage,
+            );
+            selected_index = region
+                .dominant_key(|key| {
+                    matches!(
+                        key.kind,
+                        crate::render::PickKind::SceneMesh | crate::render::PickKind::LightHelper
+                    )
+                })
+                .and_then(|key| i32::try_from(key.object_id).ok())
+                .unwrap_or(-1);
+        }
         // Hover highlight: while idle in transform modes, pick continuously under cursor.
         if self.transform_tool_mode != TransformToolMode::Select
             && !self.mouse_buttons[0]
@@ -2078,8 +2363,11 @@ impl App {
             && !self.mouse_over_sidebar_ui()
         {
             if let (Some((mx, my)), Some(render)) = (self.mouse_pos, &mut self.render) {
-                render.request_pick(mx, my);
-                self.pending_pick_request = Some(PickRequestKind::HoverGizmo);
+                // Async hover results come back through `hover_pick_hit` and never
+                // occupy the click-pick request slot.
+                if !render.request_hover_pick(mx, my) {
+                    self.pending_pick_request = Some(PickRequestKind::HoverGizmo);
+                }
             }
         } else if self.transform_tool_mode == TransformToolMode::Select || !has_active_selection {
             self.gizmo_hover_axis = GIZMO_NONE;
@@ -2157,8 +2445,7 @@ impl App {
         self.gizmo_active_axis = gizmo_active_axis;
         let selected_runtime_entity = self
             .current_selection_index()
-            .and_then(|index| self.scene_runtime.get(index))
-            .and_then(|runtime| runtime.root_entity);
+            .and_then(|index| self.scene_runtime.root_entity(index));
         let selected_renderables: Vec<Entity> = self
             .current_selection_index()
             .and_then(|index| {
@@ -2166,14 +2453,9 @@ impl App {
                 if !matches!(&object.kind, SceneObjectKind::Asset(_)) {
                     return None;
                 }
-                let root_entity = self
-                    .scene_runtime
-                    .get(index)
-                    .and_then(|runtime| runtime.root_entity)?;
+                let root_entity = self.scene_runtime.root_entity(index)?;
                 self.assets
-                    .loaded_assets()
-                    .iter()
-                    .find(|asset| asset.root_entity == root_entity)
+                    .loaded_asset(root_entity)
                     .map(|asset| asset.renderable_entities.clone())
             })
             .unwrap_or_default();
@@ -2339,7 +2621,7 @@ impl App {
         let mut effective_apply_index = material_binding_apply_index;
         if material_binding_pick_index >= 0 {
             if let Some(path) = rfd::FileDialog::new()
-                .add_filter("Texture", &["ktx", "png", "jpg", "jpeg"])
+                .add_filter("Texture", &["ktx", "ktx2", "png", "jpg", "jpeg"])
                 .pick_file()
             {
                 if let Some(path_string) = path.to_str() {
@@ -2378,6 +2660,7 @@ impl App {
                         row.uv_offset,
                         row.uv_scale,
                         row.uv_rotation_deg,
+                        self.texture_compression,
                     ) {
                         Ok(texture_binding) => {
                             let result = self.execute_scene_command(
@@ -2504,9 +2787,12 @@ impl App {
             .map(|h| h.setup_success && !h.import_attempted)
             .unwrap_or(false);
         if should_attempt_import {
+            let import_started = Instant::now();
             let mut import_paths = Vec::new();
             if let Some(harness) = &self.harness {
-                import_paths.push(harness.config.import_path.clone());
+                if !harness.config.import_path.is_empty() {
+                    import_paths.push(harness.config.import_path.clone());
+                }
                 import_paths.extend(harness.config.extra_import_paths.iter().cloned());
             }
             let mut success = true;
@@ -2523,11 +2809,46 @@ impl App {
             }
             if let Some(harness) = &mut self.harness {
                 harness.import_attempted = true;
-                harness.import_success = success;
+                harness.import_started = Some(import_started);
+                harness.import_pending = success;
                 harness.import_error = error_message;
             }
         }
 
+        // Imports resolve once every asynchronous load has been added to the
+        // scene; settle frames count from there.
+        let assets_pending = self.assets.has_pending_loads();
+        if let Some(harness) = &mut self.harness {
+            if harness.import_pending && !assets_pending {
+                harness.import_pending = false;
+                harness.import_success = true;
+                let settled_frame = harness
+                    .frame_count
+                    .saturating_add(harness.config.settle_frames);
+                harness.next_capture_frame = harness.next_capture_frame.max(settled_frame);
+            }
+        }
+
+        // Time to first stable frame runs from the import request to the
+        // first frame after loads and material warm-up finish whose cadence
+        // fits within twice the frame budget.
+        let warmup_pending = self
+            .render
+            .as_ref()
+            .is_some_and(|render| render.material_warmup_progress().is_some());
+        let frame_stable = self.timing.frame_dt <= self.target_frame_duration.as_secs_f32() * 2.0;
+        if let Some(harness) = &mut self.harness {
+            if harness.import_success
+                && harness.time_to_first_stable_frame_ms.is_none()
+                && !warmup_pending
+                && frame_stable
+            {
+                harness.time_to_first_stable_frame_ms = harness
+                    .import_started
+                    .map(|started| started.elapsed().as_secs_f64() * 1000.0);
+            }
+        }
+
         if let Some(harness) = &mut self.harness {
             harness.frame_count = harness.frame_count.saturating_add(1);
         }
@@ -2537,6 +2858,7 @@ impl App {
             .as_ref()
             .map(|h| {
                 h.import_success
+                    && !warmup_pending
                     && h.config.screenshot_path.is_some()
                     && !h.screenshot_attempted
                     && h.frame_count >= h.next_capture_frame
@@ -2624,7 +2946,18 @@ impl App {
                         harness.config.max_frames
                     ));
                 }
-                if harness.import_error.is_none() && !harness.import_success {
+                if harness.import_error.is_none() && harness.import_pending {
+                    let progress = self
+                        .assets
+                        .load_progress()
+                        .map(|(_, progress)| progress)
+                        .unwrap_or(0.0);
+                    harness.import_error = Some(format!(
+                        "asset loads still pending at {:.0}% after {} frames",
+                        progress * 100.0,
+                        harness.config.max_frames
+                    ));
+                } else if harness.import_error.is_none() && !harness.import_success {
                     harness.import_error = Some(format!(
                         "harness timed out after {} frames",
                         harness.config.max_frames
@@ -2658,12 +2991,15 @@ impl App {
                 if !h.setup_success {
                     return true;
                 }
-                if !h.import_attempted {
+                if !h.import_attempted || h.import_pending {
                     return false;
                 }
                 if !h.import_success {
                     return true;
                 }
+                if h.time_to_first_stable_frame_ms.is_none() {
+                    return false;
+                }
                 if h.config.screenshot_path.is_some() {
                     h.screenshot_attempted
                 } else {
@@ -2684,6 +3020,18 @@ impl App {
             .map(|h| h.config.clone())
             .ok_or_else(|| "harness configuration unavailable".to_string())?;
 
+        // The scene replaces the current one, so it loads before the harness
+        // light and environment are added.
+        if let Some(scene_path) = &config.scene_path {
+            if let Err(err) = self.command_load_scene(scene_path) {
+                return Err(format!(
+                    "failed loading harness scene '{}': {}",
+                    scene_path.display(),
+                    err
+                ));
+            }
+        }
+
         if config.add_default_light {
             let mut light = LightData::default_for(config.light_type);
             light.intensity = config.light_intensity;
@@ -2717,6 +3065,27 @@ impl App {
     }
 
     fn finish_harness_run(&mut self) {
+        let staging_ring = self
+            .render
+            .as_ref()
+            .and_then(|render| render.staging_ring_stats())
+            .map(HarnessStagingRingReport::from);
+        let pick = self
+            .render
+            .as_ref()
+            .and_then(|render| render.pick_stats())
+            .map(HarnessPickReport::from);
+        let engine_config = self.render.as_ref().map(|render| render.engine_config());
+        let material_provider = self.assets.material_provider_kind().as_str();
+        let program_cache = self
+            .render
+            .as_ref()
+            .filter(|_| self.program_cache_enabled)
+            .map(|render| HarnessProgramCacheReport::from(render.program_cache_stats()));
+        let texture_decode = self
+            .assets
+            .texture_decode_stats()
+            .map(HarnessTextureDecodeReport::from);
         let (report_json, report_path, exit_code, status_message) = {
             let Some(harness) = &mut self.harness else {
                 return;
@@ -2744,7 +3113,13 @@ impl App {
                 1
             };
             harness.finished = true;
-            let report = harness.report();
+            let mut report = harness.report();
+            report.staging_ring = staging_ring;
+            report.pick = pick;
+            report.engine_config = engine_config;
+            report.material_provider = Some(material_provider.to_string());
+            report.program_cache = program_cache;
+            report.texture_decode = texture_decode;
             let report_json = serde_json::to_string_pretty(&report).unwrap_or_else(|_| {
                 "{\"error\":\"failed to serialize harness report\"}".to_string()
             });
@@ -2872,38 +3247,105 @@ impl App {
             return Err(CommandError::RenderNotInitialized);
         };
 
-        let (engine, scene) = render.engine_scene_mut();
+        let (engine, _) = render.engine_scene_mut();
         let mut entity_manager = engine
             .entity_manager()
             .ok_or(CommandError::RenderEntityManagerUnavailable)?;
         let object_id = self.scene.reserve_object_id();
         log::info!("Loading glTF: {}", path);
-        let loaded =
-            self.assets
-                .load_gltf_from_path(engine, scene, &mut entity_manager, path, object_id)?;
-        for entity in &loaded.renderable_entities {
-            engine.renderable_set_layer_mask(*entity, 0xFF, 0x01);
+        self.assets
+            .begin_gltf_load(engine, &mut entity_manager, path, object_id)?;
+
+        Ok(CommandOutcome::None)
+    }
+
+    /// Release retired glTF resources once the GPU is done with them.
+    fn collect_retired_assets(&mut self) {
+        let Some(render) = &mut self.render else {
+            return;
+        };
+        let (engine, _) = render.engine_scene_mut();
+        self.assets.collect_retired(engine);
+    }
+
+    /// Advance asynchronous glTF loads and add finished assets to the scene model.
+    fn pump_asset_loads(&mut self) {
+        if !self.assets.has_pending_loads() {
+            return;
+        }
+        let Some(render) = &mut self.render else {
+            return;
+        };
+        let (_, scene) = render.engine_scene_mut();
+        let completed = self.assets.pump_loads(scene);
+        if completed.is_empty() {
+            return;
         }
+        render.invalidate_pick_buffer();
+        for load in completed {
+            let loaded = load.asset;
+            let (engine, _) = render.engine_scene_mut();
+            for entity in &loaded.renderable_entities {
+                engine.renderable_set_layer_mask(*entity, 0xFF, 0x01);
+            }
 
-        log::info!(
-            "Loaded glTF '{}' center={:?} extent={:?}",
-            path,
-            loaded.center,
-            loaded.extent
-        );
-        self.scene
-            .add_asset_with_id(object_id, loaded.name.clone(), path);
-        self.scene_runtime.push(RuntimeObject {
-            root_entity: Some(loaded.root_entity),
-            center: loaded.center,
-            extent: loaded.extent,
-        });
+            log::info!(
+                "Loaded glTF '{}'{} over {} frames center={:?} extent={:?}: {}",
+                load.path,
+                if loaded.instanced { " (instance)" } else { "" },
+                load.stats.frames,
+                loaded.center,
+                loaded.extent,
+                loaded.timings
+            );
+            self.scene
+                .add_asset_with_id(load.object_id, loaded.name.clone(), &load.path);
+            self.scene_runtime.push(RuntimeObject {
+                root_entity: Some(loaded.root_entity),
+                center: loaded.center,
+                extent: loaded.extent,
+                ..RuntimeObject::default()
+            });
+            let index = self.scene.objects().len() - 1;
+            self.scene_runtime.sync_identity(index, &self.scene);
+            self.orbit_pivot = loaded.center;
+            self.camera = CameraController::from_bounds(loaded.center, loaded.extent);
+            self.camera.apply(render.camera_mut());
+            if let Some(harness) = &mut self.harness {
+                harness.asset_loads.push(HarnessAssetLoadReport::new(
+                    load.path,
+                    &loaded,
+                    load.stats,
+                ));
+            }
+        }
         apply_scene_material_overrides_to_runtime(&self.scene, &mut self.assets);
-        self.orbit_pivot = loaded.center;
-        self.camera = CameraController::from_bounds(loaded.center, loaded.extent);
-        self.camera.apply(render.camera_mut());
+        render.begin_material_warmup(self.assets.material_instances());
+    }
 
-        Ok(CommandOutcome::None)
+    /// Track the background material warm-up and report it once finished.
+    fn poll_material_warmup(&mut self) {
+        let Some(render) = &mut self.render else {
+            return;
+        };
+        let finished = render.poll_material_warmup();
+        self.ui
+            .set_material_warmup_progress(render.material_warmup_progress());
+        let Some((materials, elapsed)) = finished else {
+            return;
+        };
+        let compile_ms = elapsed.as_secs_f64() * 1000.0;
+        log::info!(
+            "Material warm-up: {} materials compiled in {:.1} ms",
+            materials,
+            compile_ms
+        );
+        if let Some(harness) = &mut self.harness {
+            harness.material_warmup = Some(HarnessMaterialWarmupReport {
+                materials,
+                compile_ms,
+            });
+        }
     }
 
     fn command_add_light(
@@ -2942,7 +3384,11 @@ impl App {
             root_entity: Some(light_entity),
             center: data.position,
             extent: [0.0, 0.0, 0.0],
+            ..RuntimeObject::default()
         });
+        let index = self.scene.objects().len() - 1;
+        self.scene_runtime.sync_identity(index, &self.scene);
+        self.scene_runtime.set_light(index, &data);
 
         Ok(CommandOutcome::None)
     }
@@ -2956,6 +3402,11 @@ impl App {
             .scene
             .object_mut(index)
             .ok_or(CommandError::SceneObjectNotFound { index })?;
+        let previous_type = match &object.kind {
+            SceneObjectKind::Light(existing) => Some(existing.light_type),
+            SceneObjectKind::DirectionalLight(_) => Some(LightType::Directional),
+            _ => None,
+        };
         match &mut object.kind {
             SceneObjectKind::Light(existing) => {
                 *existing = data.clone();
@@ -2970,18 +3421,23 @@ impl App {
             }
             _ => return Err(CommandError::SceneObjectNotLight { index }),
         }
-        if let Some(runtime) = self.scene_runtime.get_mut(index) {
-            runtime.center = data.position;
+        self.scene_runtime.set_light(index, &data);
+        if previous_type != Some(data.light_type) {
+            // Filament cannot change the type of an existing light; the
+            // reconcile builds it again.
+            return match self.reconcile_runtime_scene() {
+                Ok(()) => Ok(CommandOutcome::None),
+                Err(err) => Ok(CommandOutcome::Notice(CommandNotice {
+                    severity: CommandSeverity::Warning,
+                    message: format!("Light type changed with warnings:\n{}", err),
+                })),
+            };
         }
 
         let Some(render) = &mut self.render else {
             return Err(CommandError::RenderNotInitialized);
         };
-        if let Some(light_entity) = self
-            .scene_runtime
-            .get(index)
-            .and_then(|runtime| runtime.root_entity)
-        {
+        if let Some(light_entity) = self.scene_runtime.root_entity(index) {
             render.set_light(light_entity, scene_light_to_filament_params(&data));
         }
         Ok(CommandOutcome::None)
@@ -3019,6 +3475,17 @@ impl App {
         if !had_environment {
             self.scene_runtime.push(RuntimeObject::default());
         }
+        if apply_runtime {
+            let environment_id = self
+                .scene
+                .objects()
+                .iter()
+                .find(|object| matches!(object.kind, SceneObjectKind::Environment(_)))
+                .map(|object| object.id);
+            if let Some(object_id) = environment_id {
+                self.sync_runtime_identity(object_id);
+            }
+        }
 
         if apply_runtime {
             Ok(CommandOutcome::Notice(CommandNotice {
@@ -3061,6 +3528,9 @@ impl App {
             }
             break;
         }
+        if applied_any {
+            self.sync_runtime_identity(object_id);
+        }
 
         if applied_any {
             Ok(CommandOutcome::None)
@@ -3140,6 +3610,7 @@ impl App {
             binding.wrap_repeat_v,
         );
         if applied {
+            self.sync_runtime_identity(object_id);
             Ok(CommandOutcome::Notice(CommandNotice {
                 severity: CommandSeverity::Info,
                 message: format!(
@@ -3193,11 +3664,7 @@ impl App {
             }
         }
 
-        let Some(entity) = self
-            .scene_runtime
-            .get(index)
-            .and_then(|runtime| runtime.root_entity)
-        else {
+        let Some(entity) = self.scene_runtime.root_entity(index) else {
             return Ok(CommandOutcome::Notice(CommandNotice {
                 severity: CommandSeverity::Warning,
                 message: format!(
@@ -3212,12 +3679,12 @@ impl App {
         };
         if let Some(light) = updated_light {
             render.set_light(entity, scene_light_to_filament_params(&light));
-            if let Some(runtime) = self.scene_runtime.get_mut(index) {
-                runtime.center = light.position;
-            }
+            self.scene_runtime.set_light(index, &light);
         } else {
             let matrix = compose_transform_matrix(position, rotation_deg, scale);
-            if !render.set_entity_transform(entity, matrix) {
+            self.scene_runtime.set_transform(index, matrix);
+            let updates = self.scene_runtime.take_dirty_transforms();
+            if !render.set_entity_transforms(&updates) {
                 return Err(CommandError::RenderTransformManagerUnavailable);
             }
         }
@@ -3268,7 +3735,7 @@ impl App {
             object_count_before,
             object_count_after,
         );
-        match self.rebuild_runtime_scene() {
+        match self.reconcile_runtime_scene() {
             Ok(()) => Ok(CommandOutcome::Notice(CommandNotice {
                 severity: CommandSeverity::Info,
                 message: format!("Deleted object '{}'.", removed.name),
@@ -3297,7 +3764,9 @@ impl App {
     ) -> Result<CommandOutcome, CommandError> {
         let loaded_scene = crate::scene::serialization::load_scene_from_file(path)?;
         self.scene = loaded_scene;
-        match self.rebuild_runtime_scene() {
+        // Loads still in flight belong to the scene being replaced.
+        self.assets.cancel_pending_loads();
+        match self.reconcile_runtime_scene() {
             Ok(()) => Ok(CommandOutcome::Notice(CommandNotice {
                 severity: CommandSeverity::Info,
                 message: format!("Scene loaded: {}", path.display()),
@@ -3337,7 +3806,7 @@ impl App {
 
     fn handle_save_scene_action(&mut self) {
         if let Some(path) = rfd::FileDialog::new()
-            .add_filter("Scene", &["json"])
+            .add_filter("Scene", &["json", BINARY_SCENE_EXTENSION])
             .set_file_name("scene.json")
             .save_file()
         {
@@ -3348,7 +3817,7 @@ impl App {
 
     fn handle_load_scene_action(&mut self) {
         let Some(path) = rfd::FileDialog::new()
-            .add_filter("Scene", &["json"])
+            .add_filter("Scene", &["json", BINARY_SCENE_EXTENSION])
             .pick_file()
         else {
             return;
@@ -3383,125 +3852,248 @@ impl App {
         format!("{prefix} {next_index}")
     }
 
-    fn rebuild_runtime_scene(&mut self) -> Result<(), String> {
+    /// Mark the runtime object for `object_id` as up to date with the scene
+    /// after a command applied its change in place.
+    fn sync_runtime_identity(&mut self, object_id: u64) {
+        if let Some(index) = self.scene_index_of(object_id) {
+            self.scene_runtime.sync_identity(index, &self.scene);
+        }
+    }
+
+    /// Bring the Filament scene in line with `self.scene` by object id. Objects
+    /// whose kind and rebuild signature are unchanged keep their loaded assets,
+    /// lights and environment and only get transforms and light parameters
+    /// updated; the rest are destroyed or built. Nothing is torn down wholesale,
+    /// so no GPU drain is needed: removed assets are retired and released
+    /// behind a fence by `collect_retired_assets`.
+    fn reconcile_runtime_scene(&mut self) -> Result<(), String> {
         let Some(render) = &mut self.render else {
             return Ok(());
         };
         self.scene.migrate_legacy_light_objects();
         self.scene.ensure_object_ids();
 
-        // Conservative teardown order for native resource safety:
-        // 1) drain GPU work
-        // 2) detach/replace scene references
-        // 3) drop asset-owned resources
-        // 4) drain again before rebuilding
-        log::info!("Runtime rebuild: flush before teardown");
-        render.flush_and_wait();
-        log::info!("Runtime rebuild: clear scene references");
-        render.clear_scene();
-        render.flush_and_wait();
-        log::info!("Runtime rebuild: rotate asset generations");
-        self.assets.prepare_for_scene_rebuild();
-        render.flush_and_wait();
-        self.scene_runtime.clear();
+        let reconcile_start = Instant::now();
+        let diff = self.scene_runtime.diff(&self.scene);
+        log::info!(
+            "Reconciling runtime scene: keep {}, create {}, destroy {}",
+            diff.keep.len(),
+            diff.create.len(),
+            diff.destroy.len()
+        );
+        let scene_has_environment = self
+            .scene
+            .objects()
+            .iter()
+            .any(|object| matches!(object.kind, SceneObjectKind::Environment(_)));
+        for &runtime_index in &diff.destroy {
+            let Some(runtime) = self.scene_runtime.get(runtime_index) else {
+                continue;
+            };
+            match runtime.kind {
+                RuntimeKind::Asset => {
+                    let (_, scene) = render.engine_scene_mut();
+                    self.assets.remove_object(runtime.object_id, scene);
+                }
+                RuntimeKind::Light => {
+                    if let Some(entity) = runtime.root_entity {
+                        render.destroy_light(entity);
+                    }
+                }
+                RuntimeKind::Environment => {
+                    if !scene_has_environment {
+                        render.clear_environment();
+                    }
+                }
+                RuntimeKind::Empty => {}
+            }
+        }
+        if !diff.destroy.is_empty() || !diff.create.is_empty() {
+            // Pick keys and selection refer to scene objects by index.
+            render.invalidate_scene_picks();
+        }
 
         let source_objects = self.scene.objects().to_vec();
-        let mut runtime_objects = Vec::with_capacity(source_objects.len());
-        let mut transforms_to_apply: Vec<(Entity, [f32; 16])> = Vec::new();
-        let mut environment_data: Option<EnvironmentData> = None;
+        self.scene_runtime.reorder(&diff.keep, source_objects.len());
+        let mut reused = vec![false; source_objects.len()];
+        for &(_, scene_index) in &diff.keep {
+            reused[scene_index] = true;
+        }
+
+        // Map, parse and decode new assets and read their textures on a worker
+        // pool; only engine object creation below stays on this thread.
+        let mut pipeline = LoadPipeline::new();
+        let mut jobs = Vec::new();
+        let mut queued = HashSet::new();
+        let mut new_asset_ids = HashSet::new();
+        for (index, object) in source_objects.iter().enumerate() {
+            let SceneObjectKind::Asset(data) = &object.kind else {
+                continue;
+            };
+            if reused[index] {
+                continue;
+            }
+            new_asset_ids.insert(object.id);
+            if self.assets.needs_source(&data.path) && queued.insert(data.path.clone()) {
+                jobs.push(PrepareJob::Gltf {
+                    path: data.path.clone(),
+                });
+            }
+        }
+        for entry in self.scene.texture_bindings() {
+            if new_asset_ids.contains(&entry.object_id)
+                && queued.insert(load_pipeline::texture_key(&entry.binding))
+            {
+                jobs.push(PrepareJob::texture(
+                    &entry.binding,
+                    self.texture_compression,
+                ));
+            }
+        }
+        let prepared = pipeline.prepare(jobs);
+        for gltf in prepared.gltf {
+            self.assets.stage_prepared(gltf);
+        }
+        let started_transcodes = pipeline.record("begin-transcodes", "", || {
+            prepared
+                .textures
+                .iter()
+                .filter_map(|(key, bytes)| {
+                    let bytes = bytes.as_ref().ok()?;
+                    Some((key.clone(), render.begin_ktx2_transcode(bytes)?))
+                })
+                .collect::<Vec<_>>()
+        });
+        let mut transcoded = pipeline.transcode(started_transcodes);
+
+        let mut lights_to_update: Vec<(Entity, FilamentLightParams)> = Vec::new();
+        let mut environment_data: Option<(EnvironmentData, bool)> = None;
+        let mut created_asset_ids: Vec<u64> = Vec::new();
         let mut errors: Vec<String> = Vec::new();
+        let mut asset_timings = AssetLoadTimings::default();
+        let mut rehydrated_assets = 0usize;
+        let mut instanced_assets = 0usize;
 
         {
             let (engine, scene) = render.engine_scene_mut();
             let Some(mut entity_manager) = engine.entity_manager() else {
-                return Err("Entity manager unavailable during runtime rebuild.".to_string());
+                return Err("Entity manager unavailable during runtime reconcile.".to_string());
             };
-            log::info!(
-                "Rebuilding runtime scene from {} serialized objects",
-                source_objects.len()
-            );
-            for object in source_objects {
+            for (index, object) in source_objects.iter().enumerate() {
+                let kept = reused[index];
                 match object.kind.clone() {
                     SceneObjectKind::Asset(data) => {
+                        let matrix =
+                            compose_transform_matrix(data.position, data.rotation_deg, data.scale);
+                        if kept {
+                            self.scene_runtime.set_transform(index, matrix);
+                            continue;
+                        }
                         log::info!("Rehydrate asset '{}'", data.path);
-                        match self.assets.load_gltf_from_path(
-                            engine,
-                            scene,
-                            &mut entity_manager,
-                            &data.path,
-                            object.id,
-                        ) {
+                        let result = pipeline.record("create-asset", &data.path, || {
+                            self.assets.load_gltf_from_path(
+                                engine,
+                                scene,
+                                &mut entity_manager,
+                                &data.path,
+                                object.id,
+                            )
+                        });
+                        match result {
                             Ok(loaded) => {
+                                log::info!(
+                                    "Rehydrated '{}'{}: {}",
+                                    data.path,
+                                    if loaded.instanced { " (instance)" } else { "" },
+                                    loaded.timings
+                                );
+                                asset_timings.accumulate(&loaded.timings);
+                                rehydrated_assets += 1;
+                                if loaded.instanced {
+                                    instanced_assets += 1;
+                                }
                                 for entity in &loaded.renderable_entities {
                                     engine.renderable_set_layer_mask(*entity, 0xFF, 0x01);
                                 }
-                                transforms_to_apply.push((
-                                    loaded.root_entity,
-                                    compose_transform_matrix(
-                                        data.position,
-                                        data.rotation_deg,
-                                        data.scale,
-                                    ),
-                                ));
-                                runtime_objects.push(RuntimeObject {
-                                    root_entity: Some(loaded.root_entity),
-                                    center: loaded.center,
-                                    extent: loaded.extent,
-                                });
+                                created_asset_ids.push(object.id);
+                                self.scene_runtime
+                                    .set_root_entity(index, loaded.root_entity);
+                                self.scene_runtime
+                                    .set_bounds(index, loaded.center, loaded.extent);
+                                self.scene_runtime.set_transform(index, matrix);
                             }
                             Err(err) => {
                                 errors
                                     .push(format!("Asset '{}' failed to load: {}", data.path, err));
-                                runtime_objects.push(RuntimeObject::default());
                             }
                         }
                     }
-                    SceneObjectKind::Light(data) => {
-                        let light_entity =
-                            engine.create_light(&mut entity_manager, scene_light_to_filament_params(&data));
-                        scene.add_entity(light_entity);
-                        runtime_objects.push(RuntimeObject {
-                            root_entity: Some(light_entity),
-                            center: data.position,
-                            extent: [0.0, 0.0, 0.0],
-                        });
-                    }
-                    SceneObjectKind::DirectionalLight(data) => {
-                        let migrated = LightData::from_legacy_directional(data);
-                        let light_entity = engine
-                            .create_light(&mut entity_manager, scene_light_to_filament_params(&migrated));
-                        scene.add_entity(light_entity);
-                        runtime_objects.push(RuntimeObject {
-                            root_entity: Some(light_entity),
-                            center: migrated.position,
-                            extent: [0.0, 0.0, 0.0],
-                        });
+                    SceneObjectKind::Light(_) | SceneObjectKind::DirectionalLight(_) => {
+                        let data = match object.kind.clone() {
+                            SceneObjectKind::DirectionalLight(legacy) => {
+                                LightData::from_legacy_directional(legacy)
+                            }
+                            SceneObjectKind::Light(data) => data,
+                            SceneObjectKind::Asset(_) | SceneObjectKind::Environment(_) => continue,
+                        };
+                        let params = scene_light_to_filament_params(&data);
+                        match self.scene_runtime.root_entity(index).filter(|_| kept) {
+                            Some(light_entity) => lights_to_update.push((light_entity, params)),
+                            None => {
+                                let light_entity = engine.create_light(&mut entity_manager, params);
+                                scene.add_entity(light_entity);
+                                self.scene_runtime.set_root_entity(index, light_entity);
+                            }
+                        }
+                        self.scene_runtime.set_light(index, &data);
                     }
                     SceneObjectKind::Environment(data) => {
-                        environment_data = Some(data);
-                        runtime_objects.push(RuntimeObject::default());
+                        environment_data = Some((data, kept));
                     }
                 }
             }
         }
-        self.scene_runtime.replace(runtime_objects);
+        self.assets.clear_prepared();
+        if rehydrated_assets > 0 {
+            log::info!(
+                "Rehydrated {} assets ({} instanced): {}",
+                rehydrated_assets,
+                instanced_assets,
+                asset_timings
+            );
+        }
+        self.scene_runtime.sync_identities(&self.scene);
         apply_scene_material_overrides_to_runtime(&self.scene, &mut self.assets);
-        apply_scene_texture_bindings_to_runtime(&self.scene, &mut self.assets, render, &mut errors);
+        pipeline.record("bind-textures", "", || {
+            apply_scene_texture_bindings_to_runtime(
+                &self.scene,
+                &mut self.assets,
+                render,
+                &created_asset_ids,
+                &prepared.textures,
+                &mut transcoded,
+                &mut errors,
+            )
+        });
 
-        for (entity, matrix) in transforms_to_apply {
-            if !render.set_entity_transform(entity, matrix) {
-                errors.push(format!(
-                    "Transform manager unavailable while applying transform to entity {}.",
-                    entity.id
-                ));
-            }
+        // Only kept assets that moved and newly created ones are dirty.
+        let transforms_to_apply = self.scene_runtime.take_dirty_transforms();
+        if !render.set_entity_transforms(&transforms_to_apply) {
+            errors.push(format!(
+                "Transform manager unavailable while applying {} asset transforms.",
+                transforms_to_apply.len()
+            ));
         }
-        if let Some(environment) = environment_data {
-            let env_ok = render.set_environment(
-                &environment.ibl_path,
-                &environment.skybox_path,
-                environment.intensity,
-            );
+        render.set_lights(&lights_to_update);
+        if let Some((environment, kept)) = environment_data {
+            let env_ok = kept
+                || pipeline.record("create-environment", &environment.ibl_path, || {
+                    render.set_environment(
+                        &environment.ibl_path,
+                        &environment.skybox_path,
+                        environment.intensity,
+                    )
+                });
             if env_ok {
                 render.set_environment_intensity(environment.intensity);
                 let (hdr, ibl, sky) = self.ui.environment_paths_mut();
@@ -3509,13 +4101,39 @@ impl App {
                 write_string_to_buffer(&environment.ibl_path, ibl);
                 write_string_to_buffer(&environment.skybox_path, sky);
                 self.ui.set_environment_intensity(environment.intensity);
-                self.ui
-                    .set_environment_status("Environment loaded.".to_string());
+                if !kept {
+                    self.ui
+                        .set_environment_status("Environment loaded.".to_string());
+                }
             } else if !environment.ibl_path.is_empty() || !environment.skybox_path.is_empty() {
                 errors.push("Environment failed to load from scene file.".to_string());
             }
         }
 
+        if !created_asset_ids.is_empty() {
+            render.begin_material_warmup(self.assets.material_instances());
+        }
+        log::info!(
+            "Runtime scene reconciled in {:.1} ms",
+            reconcile_start.elapsed().as_secs_f64() * 1000.0
+        );
+        let timeline = pipeline.finish();
+        if timeline.jobs > 0 {
+            log::info!(
+                "Scene load pipeline: {} jobs on {} workers, prepare {:.1} ms, create {:.1} ms, total {:.1} ms",
+                timeline.jobs,
+                timeline.workers,
+                timeline.prepare_ms,
+                timeline.create_ms,
+                timeline.total_ms
+            );
+        }
+        if !diff.create.is_empty() {
+            if let Some(harness) = &mut self.harness {
+                harness.scene_loads.push(timeline);
+            }
+        }
+
         match format_rebuild_errors(&errors) {
             Some(message) => Err(message),
             None => Ok(()),
@@ -3825,6 +4443,45 @@ mod tests {
         assert_eq!(binding.binding.texture_param, "normalMap");
     }
 
+    #[test]
+    fn auto_texture_compression_picks_mode_by_color_space() {
+        let auto = TextureCompression::from_str("AUTO").expect("known mode");
+        assert_eq!(
+            auto.resolve(TextureColorSpace::Srgb),
+            Some(TextureCompression::Etc1s)
+        );
+        assert_eq!(
+            auto.resolve(TextureColorSpace::Linear),
+            Some(TextureCompression::Uastc)
+        );
+        assert_eq!(
+            TextureCompression::None.resolve(TextureColorSpace::Srgb),
+            None
+        );
+        assert_eq!(TextureCompression::from_str("bc7"), None);
+    }
+
+    #[test]
+    fn cache_entries_are_published_by_rename() {
+        let dir = std::env::temp_dir().join(format!("previz_cache_publish_{}", std::process::id()));
+        std::fs::create_dir_all(&dir).unwrap();
+        let entry = dir.join("abc_srgb.ktx2");
+        let first = super::cache_temp_path(&entry);
+        let second = super::cache_temp_path(&entry);
+        assert_ne!(first, second);
+        assert_eq!(first.extension(), entry.extension());
+
+        std::fs::write(&first, b"one").unwrap();
+        std::fs::write(&second, b"two").unwrap();
+        super::publish_cache_file(&first, &entry).unwrap();
+        super::publish_cache_file(&second, &entry).unwrap();
+        let published = std::fs::read(&entry).unwrap();
+        let leftovers = std::fs::read_dir(&dir).unwrap().count();
+        let _ = std::fs::remove_dir_all(&dir);
+        assert!(published == b"one" || published == b"two");
+        assert_eq!(leftovers, 1);
+    }
+
     #[test]
     fn default_transform_tool_is_select() {
         let app = App::new();
@@ -3942,6 +4599,7 @@ fn prepare_texture_binding_data(
     uv_offset: [f32; 2],
     uv_scale: [f32; 2],
     uv_rotation_deg: f32,
+    compression: TextureCompression,
 ) -> Result<MaterialTextureBindingData, String> {
     let texture_param = texture_param.trim();
     if texture_param.is_empty() {
@@ -3953,7 +4611,8 @@ fn prepare_texture_binding_data(
     }
 
     let source_kind = MediaSourceKind::Image;
-    let (runtime_ktx_path, source_hash) = resolve_runtime_texture_cache(source_path, color_space)?;
+    let (runtime_ktx_path, source_hash) =
+        resolve_runtime_texture_cache(source_path, color_space, compression)?;
 
     Ok(MaterialTextureBindingData {
         texture_param: texture_param.to_string(),
@@ -4013,6 +4672,7 @@ fn sync_material_binding_rows_from_scene(
 fn resolve_runtime_texture_cache(
     source_path: &str,
     color_space: TextureColorSpace,
+    compression: TextureCompression,
 ) -> Result<(String, String), String> {
     let source = resolve_path_for_read(source_path)?;
     let extension = source
@@ -4020,13 +4680,13 @@ fn resolve_runtime_texture_cache(
         .and_then(|value| value.to_str())
         .unwrap_or("")
         .to_ascii_lowercase();
-    if extension == "ktx" {
+    if extension == "ktx" || extension == "ktx2" {
         let hash = hash_file_bytes(&source)?;
         return Ok((display_path_for_scene(&source), hash));
     }
     if extension != "png" && extension != "jpg" && extension != "jpeg" {
         return Err(format!(
-            "Unsupported texture source extension '{}'. Use .ktx/.png/.jpg/.jpeg.",
+            "Unsupported texture source extension '{}'. Use .ktx/.ktx2/.png/.jpg/.jpeg.",
             extension
         ));
     }
@@ -4041,6 +4701,15 @@ fn resolve_runtime_texture_cache(
     let cache_dir = manifest_dir.join("assets").join("cache").join("textures");
     std::fs::create_dir_all(&cache_dir)
         .map_err(|err| format!("Failed to create texture cache folder: {}", err))?;
+    if let Some(mode) = compression.resolve(color_space) {
+        match encode_basis_texture(&source, &cache_dir, &source_hash, color_space, mode) {
+            Ok(ktx2_path) => {
+                let mode_hash = format!("{source_hash}_{}", mode.as_str());
+                return Ok((display_path_for_scene(&ktx2_path), mode_hash));
+            }
+            Err(err) => log::warn!("{}; falling back to uncompressed KTX.", err),
+        }
+    }
     let ktx_path = cache_dir.join(format!("{source_hash}.ktx"));
     if !ktx_path.exists() {
         let normalized_png_path =
@@ -4049,6 +4718,7 @@ fn resolve_runtime_texture_cache(
         if !mipgen_path.exists() {
             return Err(format!("mipgen not found at {}", mipgen_path.display()));
         }
+        let temp_path = cache_temp_path(&ktx_path);
         let status = Command::new(&mipgen_path)
             .args(["-q", "-f", "ktx"])
             .args(match color_space {
@@ -4056,16 +4726,59 @@ fn resolve_runtime_texture_cache(
                 TextureColorSpace::Linear => vec!["--linear"],
             })
             .arg(&normalized_png_path)
-            .arg(&ktx_path)
+            .arg(&temp_path)
             .status()
             .map_err(|err| format!("Failed to run mipgen: {}", err))?;
         if !status.success() {
+            let _ = std::fs::remove_file(&temp_path);
             return Err(format!("mipgen failed with status {:?}", status.code()));
         }
+        publish_cache_file(&temp_path, &ktx_path)?;
     }
     Ok((display_path_for_scene(&ktx_path), source_hash))
 }
 
+/// Encode `source` as a mipmapped Basis KTX2 in the texture cache.
+fn encode_basis_texture(
+    source: &std::path::Path,
+    cache_dir: &std::path::Path,
+    source_hash: &str,
+    color_space: TextureColorSpace,
+    mode: TextureCompression,
+) -> Result<PathBuf, String> {
+    let ktx2_path = cache_dir.join(format!("{source_hash}_{}.ktx2", mode.as_str()));
+    if ktx2_path.exists() {
+        return Ok(ktx2_path);
+    }
+    let basisu_path = PathBuf::from(env!("FILAMENT_BIN_DIR")).join("basisu.exe");
+    if !basisu_path.exists() {
+        return Err(format!("basisu not found at {}", basisu_path.display()));
+    }
+    let normalized_png_path = ensure_normalized_png_for_mipgen(source, cache_dir, source_hash)?;
+    let temp_path = cache_temp_path(&ktx2_path);
+    let status = Command::new(&basisu_path)
+        .args(["-ktx2", "-mipmap"])
+        .args(match mode {
+            TextureCompression::Uastc => vec!["-uastc"],
+            _ => Vec::<&str>::new(),
+        })
+        .args(match color_space {
+            TextureColorSpace::Srgb => Vec::<&str>::new(),
+            TextureColorSpace::Linear => vec!["-linear"],
+        })
+        .arg("-output_file")
+        .arg(&temp_path)
+        .arg(&normalized_png_path)
+        .status()
+        .map_err(|err| format!("Failed to run basisu: {}", err))?;
+    if !status.success() {
+        let _ = std::fs::remove_file(&temp_path);
+        return Err(format!("basisu failed with status {:?}", status.code()));
+    }
+    publish_cache_file(&temp_path, &ktx2_path)?;
+    Ok(ktx2_path)
+}
+
 fn ensure_normalized_png_for_mipgen(
     source: &std::path::Path,
     cache_dir: &std::path::Path,
@@ -4091,19 +4804,60 @@ fn ensure_normalized_png_for_mipgen(
                 err
             )
         })?;
+    let temp_path = cache_temp_path(&normalized_png_path);
     image
         .to_rgba8()
-        .save_with_format(&normalized_png_path, image::ImageFormat::Png)
+        .save_with_format(&temp_path, image::ImageFormat::Png)
         .map_err(|err| {
+            let _ = std::fs::remove_file(&temp_path);
             format!(
                 "Failed to write normalized PNG '{}': {}",
                 normalized_png_path.display(),
                 err
             )
         })?;
+    publish_cache_file(&temp_path, &normalized_png_path)?;
     Ok(normalized_png_path)
 }
 
+/// A path next to `path` that no other writer uses, keeping its extension.
+/// Cache entries are written there and renamed into place, so the worker
+/// pool and the editor never read a half-written entry and concurrent
+/// rebuilds of the same entry do not collide.
+fn cache_temp_path(path: &std::path::Path) -> PathBuf {
+    static NEXT: AtomicU64 = AtomicU64::new(0);
+    let unique = NEXT.fetch_add(1, Ordering::Relaxed);
+    let stem = path
+        .file_stem()
+        .and_then(|value| value.to_str())
+        .unwrap_or("entry");
+    let name = match path.extension().and_then(|value| value.to_str()) {
+        Some(extension) => format!("{stem}.{}-{unique}.tmp.{extension}", std::process::id()),
+        None => format!("{stem}.{}-{unique}.tmp", std::process::id()),
+    };
+    path.with_file_name(name)
+}
+
+/// Rename a finished cache entry into place. Entries are content-addressed,
+/// so when a concurrent writer got there first either copy will do.
+fn publish_cache_file(temp_path: &std::path::Path, path: &std::path::Path) -> Result<(), String> {
+    match std::fs::rename(temp_path, path) {
+        Ok(()) => Ok(()),
+        Err(_) if path.exists() => {
+            let _ = std::fs::remove_file(temp_path);
+            Ok(())
+        }
+        Err(err) => {
+            let _ = std::fs::remove_file(temp_path);
+            Err(format!(
+                "Failed to move cache entry into '{}': {}",
+                path.display(),
+                err
+            ))
+        }
+    }
+}
+
 fn resolve_path_for_read(path: &str) -> Result<PathBuf, String> {
     let raw = PathBuf::from(path);
     if raw.exists() {
@@ -4256,65 +5010,100 @@ fn apply_material_override(
 }
 
 fn apply_scene_material_overrides_to_runtime(scene: &SceneState, assets: &mut AssetManager) {
-    if scene.material_overrides().is_empty() {
+    let overrides = scene.material_overrides();
+    if overrides.is_empty() {
         return;
     }
-    let binding_count = assets.material_instances().len();
-    for override_entry in scene.material_overrides() {
-        let target_object_id = override_entry.object_id;
-        let target_asset_path = override_entry.asset_path.as_deref();
-        let target_slot = override_entry.material_slot;
-        for index in 0..binding_count {
+    // Overrides by object id and slot use the asset manager's index; the rest
+    // match on asset path and slot, or on material name for legacy scenes.
+    let mut by_path_slot: HashMap<(&str, usize), Vec<usize>> = HashMap::new();
+    let mut by_name: HashMap<&str, Vec<usize>> = HashMap::new();
+    if overrides.iter().any(|entry| entry.object_id.is_none()) {
+        for index in 0..assets.material_instances().len() {
             let Some(binding) = assets.material_binding(index) else {
                 continue;
             };
-            let matches_object_slot = target_object_id == Some(binding.object_id)
-                && target_slot == Some(binding.material_slot);
-            let matches_path_slot = target_object_id.is_none()
-                && target_asset_path == Some(binding.asset_path.as_str())
-                && target_slot == Some(binding.material_slot);
-            let matches_legacy_name = target_asset_path.is_none()
-                && target_object_id.is_none()
-                && target_slot.is_none()
-                && !override_entry.material_name.is_empty()
-                && override_entry.material_name == binding.material_name;
-            if !(matches_object_slot || matches_path_slot || matches_legacy_name) {
-                continue;
+            by_path_slot
+                .entry((binding.asset_path.as_str(), binding.material_slot))
+                .or_default()
+                .push(index);
+            by_name
+                .entry(binding.material_name.as_str())
+                .or_default()
+                .push(index);
+        }
+    }
+    let mut targets: Vec<(usize, &MaterialOverrideData)> = Vec::new();
+    for entry in overrides {
+        let indices = match (
+            entry.object_id,
+            entry.asset_path.as_deref(),
+            entry.material_slot,
+        ) {
+            (Some(object_id), _, Some(slot)) => {
+                assets.material_index(object_id, slot).into_iter().collect()
             }
-            if let Some(material_instance) = assets.material_instances_mut().get_mut(index) {
-                apply_material_override(material_instance, &override_entry.data);
+            (None, Some(path), Some(slot)) => {
+                by_path_slot.get(&(path, slot)).cloned().unwrap_or_default()
             }
+            (None, None, None) if !entry.material_name.is_empty() => by_name
+                .get(entry.material_name.as_str())
+                .cloned()
+                .unwrap_or_default(),
+            _ => Vec::new(),
+        };
+        targets.extend(indices.into_iter().map(|index| (index, &entry.data)));
+    }
+    for (index, data) in targets {
+        if let Some(material_instance) = assets.material_instances_mut().get_mut(index) {
+            apply_material_override(material_instance, data);
         }
     }
 }
 
+/// Bind the scene's textures to the material instances of `object_ids`. Kept
+/// objects already have theirs; binding again would load another texture.
+/// KTX files already read by the load pipeline are taken from `prepared`,
+/// keyed by `load_pipeline::texture_key`, and KTX2 files it transcoded from
+/// `transcoded`; the rest are read here.
 fn apply_scene_texture_bindings_to_runtime(
     scene: &SceneState,
     assets: &mut AssetManager,
     render: &mut RenderContext,
+    object_ids: &[u64],
+    prepared: &HashMap<String, Result<Vec<u8>, String>>,
+    transcoded: &mut HashMap<String, Ktx2Transcode>,
     errors: &mut Vec<String>,
 ) {
-    if scene.texture_bindings().is_empty() {
+    if scene.texture_bindings().is_empty() || object_ids.is_empty() {
         return;
     }
+    let object_ids: HashSet<u64> = object_ids.iter().copied().collect();
     for entry in scene.texture_bindings() {
-        let Some(runtime_path) = texture_binding_runtime_path(&entry.binding) else {
+        if !object_ids.contains(&entry.object_id) {
+            continue;
+        }
+        let key = load_pipeline::texture_key(&entry.binding);
+        let prepared_bytes = match prepared.get(&key) {
+            Some(Ok(bytes)) => Some(bytes.as_slice()),
+            Some(Err(err)) => {
+                errors.push(format!(
+                    "Texture binding '{}' for object {} slot {} could not be read: {}",
+                    entry.binding.texture_param, entry.object_id, entry.material_slot, err
+                ));
+                continue;
+            }
+            None => None,
+        };
+        let runtime_path = texture_binding_runtime_path(&entry.binding);
+        if prepared_bytes.is_none() && runtime_path.is_none() {
             errors.push(format!(
                 "Texture binding '{}' for object {} slot {} has no runtime .ktx path.",
                 entry.binding.texture_param, entry.object_id, entry.material_slot,
             ));
             continue;
-        };
-        let index_opt = (0..assets.material_instances().len()).find(|index| {
-            assets
-                .material_binding(*index)
-                .map(|binding| {
-                    binding.object_id == entry.object_id
-                        && binding.material_slot == entry.material_slot
-                })
-                .unwrap_or(false)
-        });
-        let Some(index) = index_opt else {
+        }
+        let Some(index) = assets.material_index(entry.object_id, entry.material_slot) else {
             errors.push(format!(
                 "Texture binding '{}' target object {} slot {} is unavailable in runtime.",
                 entry.binding.texture_param, entry.object_id, entry.material_slot
@@ -4328,17 +5117,37 @@ fn apply_scene_texture_bindings_to_runtime(
             ));
             continue;
         };
-        let applied = render.bind_material_texture_from_ktx(
-            material_instance,
-            &entry.binding.texture_param,
-            &runtime_path,
-            entry.binding.wrap_repeat_u,
-            entry.binding.wrap_repeat_v,
-        );
+        let applied = match (transcoded.get_mut(&key), prepared_bytes, &runtime_path) {
+            (Some(transcode), _, _) => render.bind_material_texture_from_ktx2_transcode(
+                material_instance,
+                &entry.binding.texture_param,
+                transcode,
+                entry.binding.wrap_repeat_u,
+                entry.binding.wrap_repeat_v,
+            ),
+            (None, Some(bytes), _) => render.bind_material_texture_from_ktx_bytes(
+                material_instance,
+                &entry.binding.texture_param,
+                bytes,
+                entry.binding.wrap_repeat_u,
+                entry.binding.wrap_repeat_v,
+            ),
+            (None, None, Some(path)) => render.bind_material_texture_from_ktx(
+                material_instance,
+                &entry.binding.texture_param,
+                path,
+                entry.binding.wrap_repeat_u,
+                entry.binding.wrap_repeat_v,
+            ),
+            (None, None, None) => false,
+        };
         if !applied {
             errors.push(format!(
                 "Texture binding '{}' failed to apply from '{}'.",
-                entry.binding.texture_param, runtime_path
+                entry.binding.texture_param,
+                runtime_path
+                    .as_deref()
+                    .unwrap_or(&entry.binding.source_path)
             ));
         }
     }
@@ -4348,12 +5157,8 @@ fn texture_binding_runtime_path(binding: &MaterialTextureBindingData) -> Option<
     if let Some(path) = &binding.runtime_ktx_path {
         return Some(path.clone());
     }
-    if binding
-        .source_path
-        .trim()
-        .to_ascii_lowercase()
-        .ends_with(".ktx")
-    {
+    let source_path = binding.source_path.trim().to_ascii_lowercase();
+    if source_path.ends_with(".ktx") || source_path.ends_with(".ktx2") {
         return Some(binding.source_path.clone());
     }
     None
@@ -4761,6 +5566,7 @@ impl ApplicationHandler for App {
                 self.gizmo_drag_state = None;
                 self.gizmo_hover_axis = GIZMO_NONE;
                 self.pending_click_select = false;
+                self.marquee_anchor = None;
                 self.pending_pick_request = None;
                 if self.ui_backend == UiBackend::ImGui {
                     if let Some(render) = &mut self.render {
@@ -4792,6 +5598,7 @@ impl ApplicationHandler for App {
                                 (MouseButton::Left, true) => {
                                     if self.transform_tool_mode == TransformToolMode::Select {
                                         self.pending_click_select = true;
+                                        self.marquee_anchor = self.mouse_pos;
                                     } else {
                                         self.pending_click_select = false;
                                         if let (Some((mx, my)), Some(render)) =
@@ -4808,12 +5615,22 @@ impl ApplicationHandler for App {
                                         if let (Some((mx, my)), Some(render)) =
                                             (self.mouse_pos, &mut self.render)
                                         {
-                                            render.request_pick(mx, my);
-                                            self.pending_pick_request =
-                                                Some(PickRequestKind::Select);
+                                            let marquee =
+                                                self.marquee_anchor.filter(|&(ax, ay)| {
+                                                    (mx - ax).abs().max((my - ay).abs())
+                                                        >= MARQUEE_MIN_DRAG_PX
+                                                });
+                                            if let Some((ax, ay)) = marquee {
+                                                render.request_region_pick(ax, ay, mx, my);
+                                            } else {
+                                                render.request_pick(mx, my);
+                                                self.pending_pick_request =
+                                                    Some(PickRequestKind::Select);
+                                            }
                                         }
                                     }
                                     self.pending_click_select = false;
+                                    self.marquee_anchor = None;
                                     self.gizmo_drag_state = None;
                                     self.gizmo_active_axis = GIZMO_NONE;
                                 }
@@ -4925,6 +5742,7 @@ fn build_harness_environment_data(
 fn parse_harness_config_from_args() -> Result<Option<HarnessConfig>, String> {
     let mut import_path: Option<String> = None;
     let mut extra_import_paths: Vec<String> = Vec::new();
+    let mut scene_path: Option<PathBuf> = None;
     let mut screenshot_path: Option<PathBuf> = None;
     let mut report_path: Option<PathBuf> = None;
     let mut settle_frames: u32 = 90;
@@ -4961,6 +5779,13 @@ fn parse_harness_config_from_args() -> Result<Option<HarnessConfig>, String> {
                 };
                 extra_import_paths.push(value);
             }
+            "--harness-scene" => {
+                saw_harness_flag = true;
+                let Some(value) = args.next() else {
+                    return Err("--harness-scene requires a path value".to_string());
+                };
+                scene_path = Some(PathBuf::from(value));
+            }
             "--harness-screenshot" => {
                 saw_harness_flag = true;
                 let Some(value) = args.next() else {
@@ -5119,8 +5944,15 @@ fn parse_harness_config_from_args() -> Result<Option<HarnessConfig>, String> {
     if !saw_harness_flag {
         return Ok(None);
     }
-    let Some(import_path) = import_path else {
-        return Err("Harness mode requires --harness-import <path-to-gltf-or-glb>".to_string());
+    let import_path = match (import_path, &scene_path) {
+        (Some(path), _) => path,
+        (None, Some(_)) => String::new(),
+        (None, None) => {
+            return Err(
+                "Harness mode requires --harness-import <path-to-gltf-or-glb> or --harness-scene <path>"
+                    .to_string(),
+            );
+        }
     };
     if max_frames == 0 {
         return Err("--harness-max-frames must be greater than zero".to_string());
@@ -5135,6 +5967,7 @@ fn parse_harness_config_from_args() -> Result<Option<HarnessConfig>, String> {
     Ok(Some(HarnessConfig {
         import_path,
         extra_import_paths,
+        scene_path,
         screenshot_path,
         report_path,
         settle_frames,
@@ -5174,6 +6007,241 @@ fn parse_ui_backend_from_args() -> UiBackend {
     UiBackend::Egui
 }
 
+fn parse_pick_readback_mode_from_args() -> PickReadbackMode {
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        if arg == "--pick-readback" {
+            if let Some(value) = args.next() {
+                if let Some(parsed) = PickReadbackMode::from_str(&value) {
+                    return parsed;
+                }
+                log::warn!(
+                    "Unknown --pick-readback '{}'; expected 'async' or 'blocking'. Falling back to async.",
+                    value
+                );
+                return PickReadbackMode::Async;
+            }
+        }
+    }
+    PickReadbackMode::Async
+}
+
+fn parse_pick_backend_from_args() -> PickBackend {
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        if arg == "--pick-backend" {
+            if let Some(value) = args.next() {
+                if let Some(parsed) = PickBackend::from_str(&value) {
+                    return parsed;
+                }
+                log::warn!(
+                    "Unknown --pick-backend '{}'; expected 'view-pick' or 'id-pass'. Falling back to view-pick.",
+                    value
+                );
+                return PickBackend::ViewPick;
+            }
+        }
+    }
+    PickBackend::ViewPick
+}
+
+/// `--material-cache on|off`; the persistent program cache is on by default.
+fn parse_program_cache_from_args() -> bool {
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        if arg == "--material-cache" {
+            if let Some(value) = args.next() {
+                match value.trim().to_ascii_lowercase().as_str() {
+                    "on" => return true,
+                    "off" => return false,
+                    _ => {
+                        log::warn!(
+                            "Unknown --material-cache '{}'; expected 'on' or 'off'. Falling back to on.",
+                            value
+                        );
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    true
+}
+
+/// `--texture-compression none|etc1s|uastc|auto`; defaults to auto.
+fn parse_texture_compression_from_args() -> TextureCompression {
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        if arg == "--texture-compression" {
+            if let Some(value) = args.next() {
+                if let Some(parsed) = TextureCompression::from_str(&value) {
+                    return parsed;
+                }
+                log::warn!(
+                    "Unknown --texture-compression '{}'; expected 'none', 'etc1s', 'uastc' or 'auto'. Falling back to auto.",
+                    value
+                );
+                return TextureCompression::Auto;
+            }
+        }
+    }
+    TextureCompression::Auto
+}
+
+/// Offline scene file commands that run instead of opening a window.
+enum SceneTool {
+    /// `--convert-scene <input> <output>`; the output extension picks the format.
+    Convert { input: PathBuf, output: PathBuf },
+    /// `--bench-scene-formats <objects>`; times JSON and binary loads.
+    BenchFormats { objects: usize },
+}
+
+fn parse_scene_tool_from_args() -> Result<Option<SceneTool>, String> {
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        match arg.as_str() {
+            "--convert-scene" => {
+                let (Some(input), Some(output)) = (args.next(), args.next()) else {
+                    return Err("--convert-scene expects <input> <output>".to_string());
+                };
+                return Ok(Some(SceneTool::Convert {
+                    input: PathBuf::from(input),
+                    output: PathBuf::from(output),
+                }));
+            }
+            "--bench-scene-formats" => {
+                let value = args
+                    .next()
+                    .ok_or_else(|| "--bench-scene-formats expects an object count".to_string())?;
+                let objects = value
+                    .parse::<usize>()
+                    .map_err(|_| format!("Invalid --bench-scene-formats value '{}'", value))?;
+                return Ok(Some(SceneTool::BenchFormats { objects }));
+            }
+            _ => {}
+        }
+    }
+    Ok(None)
+}
+
+fn run_scene_tool(tool: SceneTool) -> Result<(), crate::scene::serialization::SerializationError> {
+    match tool {
+        SceneTool::Convert { input, output } => {
+            crate::scene::serialization::convert_scene_file(&input, &output)?;
+            log::info!("Converted '{}' -> '{}'", input.display(), output.display());
+        }
+        SceneTool::BenchFormats { objects } => {
+            let dir = std::env::temp_dir().join("previz_scene_bench");
+            let bench = crate::scene::serialization::benchmark_scene_formats(objects, &dir)?;
+            log::info!(
+                "Scene formats ({} objects): json {} bytes load {:.3} ms | binary {} bytes load {:.3} ms, name scan {:.3} ms",
+                bench.objects,
+                bench.json_bytes,
+                bench.json_load_ms,
+                bench.binary_bytes,
+                bench.binary_load_ms,
+                bench.binary_scan_ms,
+            );
+            println!(
+                "{}",
+                serde_json::to_string_pretty(&bench).unwrap_or_else(|_| "{}".to_string())
+            );
+        }
+    }
+    Ok(())
+}
+
+/// Compiled programs are cached per Filament version, since the blob format and
+/// the generated shaders both change between releases.
+fn program_cache_dir() -> PathBuf {
+    PathBuf::from(env!("CARGO_MANIFEST_DIR"))
+        .join("assets")
+        .join("cache")
+        .join("materials")
+        .join(format!("filament-{}", env!("FILAMENT_VERSION")))
+}
+
+/// `--material-provider jit|ubershader`. Harness runs replay a scene without
+/// editing, so they default to the ubershader archive; the editor defaults to JIT.
+fn parse_material_provider_from_args(default: MaterialProviderKind) -> MaterialProviderKind {
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        if arg == "--material-provider" {
+            if let Some(value) = args.next() {
+                if let Some(parsed) = MaterialProviderKind::from_str(&value) {
+                    return parsed;
+                }
+                log::warn!(
+                    "Unknown --material-provider '{}'; expected 'jit' or 'ubershader'. Falling back to {}.",
+                    value,
+                    default.as_str()
+                );
+                return default;
+            }
+        }
+    }
+    default
+}
+
+/// Build the Engine::Config from `--engine-preset`, an optional `--engine-config`
+/// JSON file and individual `--engine-*` sizing flags, in increasing priority.
+fn parse_engine_config_from_args() -> (EnginePreset, EngineConfig) {
+    let mut cli_preset: Option<EnginePreset> = None;
+    let mut config_path: Option<PathBuf> = None;
+    let mut flags = EngineConfigOverrides::default();
+    let mut args = std::env::args().skip(1).peekable();
+    while let Some(arg) = args.next() {
+        if !arg.starts_with("--engine-") {
+            continue;
+        }
+        // A following flag is not a value; leave it for its own parser.
+        let Some(value) = args.next_if(|value| !value.starts_with("--")) else {
+            log::warn!("{} expects a value; ignoring it.", arg);
+            continue;
+        };
+        match arg.as_str() {
+            "--engine-preset" => match EnginePreset::from_str(&value) {
+                Some(preset) => cli_preset = Some(preset),
+                None => log::warn!(
+                    "Unknown --engine-preset '{}'; expected 'default', 'heavy-scene' or 'low-memory'.",
+                    value
+                ),
+            },
+            "--engine-config" => config_path = Some(PathBuf::from(value)),
+            _ => match flags.set_flag(&arg, &value) {
+                Ok(true) => {}
+                Ok(false) => log::warn!("Unknown engine flag '{}'; ignoring it.", arg),
+                Err(err) => log::warn!("{}; ignoring it.", err),
+            },
+        }
+    }
+
+    let file = config_path.and_then(|path| match EngineConfigOverrides::load(&path) {
+        Ok(file) => Some(file),
+        Err(err) => {
+            log::warn!("Ignoring engine config file: {}", err);
+            None
+        }
+    });
+    let file_preset = file
+        .as_ref()
+        .and_then(|file| file.preset.as_deref())
+        .and_then(|name| {
+            let preset = EnginePreset::from_str(name);
+            if preset.is_none() {
+                log::warn!("Unknown engine preset '{}' in config file.", name);
+            }
+            preset
+        });
+    let preset = cli_preset.or(file_preset).unwrap_or(EnginePreset::Default);
+    let mut config = preset.config();
+    if let Some(file) = &file {
+        file.apply(&mut config);
+    }
+    flags.apply(&mut config);
+    (preset, config)
+}
+
 fn parse_vec3_arg(value: &str, flag: &str) -> Result<[f32; 3], String> {
     let parts: Vec<&str> = value.split(',').map(|part| part.trim()).collect();
     if parts.len() != 3 {
@@ -5203,10 +6271,42 @@ pub fn run() {
             return;
         }
     };
+    match parse_scene_tool_from_args() {
+        Ok(Some(tool)) => {
+            if let Err(err) = run_scene_tool(tool) {
+                log::error!("Scene tool failed: {}", err);
+            }
+            return;
+        }
+        Ok(None) => {}
+        Err(err) => {
+            log::error!("Invalid scene tool arguments: {}", err);
+            return;
+        }
+    }
     let ui_backend = parse_ui_backend_from_args();
+    let pick_readback_mode = parse_pick_readback_mode_from_args();
+    let pick_backend = parse_pick_backend_from_args();
+    let (engine_preset, engine_config) = parse_engine_config_from_args();
+    let program_cache_enabled = parse_program_cache_from_args();
+    let texture_compression = parse_texture_compression_from_args();
+    let material_provider = parse_material_provider_from_args(if harness_config.is_some() {
+        MaterialProviderKind::Ubershader
+    } else {
+        MaterialProviderKind::Jit
+    });
 
     log::info!("🚀 Previz - Filament v1.69.0 Renderer POC");
     log::info!("   UI backend: {}", ui_backend.as_str());
+    log::info!("   Pick readback: {}", pick_readback_mode.as_str());
+    log::info!("   Pick backend: {}", pick_backend.as_str());
+    log::info!("   Engine preset: {}", engine_preset.as_str());
+    log::info!("   Material provider: {}", material_provider.as_str());
+    log::info!("   Texture compression: {}", texture_compression.as_str());
+    log::info!(
+        "   Material cache: {}",
+        if program_cache_enabled { "on" } else { "off" }
+    );
     log::info!("   Press ESC or close window to exit");
     if let Some(config) = &harness_config {
         log::info!(
@@ -5245,6 +6345,12 @@ pub fn run() {
     event_loop.set_control_flow(ControlFlow::Wait);
 
     let mut app = App::new_with_harness(harness_config, ui_backend);
+    app.pick_readback_mode = pick_readback_mode;
+    app.pick_backend = pick_backend;
+    app.engine_config = engine_config;
+    app.assets.set_material_provider_kind(material_provider);
+    app.program_cache_enabled = program_cache_enabled;
+    app.texture_compression = texture_compression;
     if let Err(err) = event_loop.run_app(&mut app) {
         let message = format!("Event loop error: {err}");
         log::error!("{message}");
@@ -0,0 +1,728 @@
+//! Memory-mapped glTF sources.
+//!
+//! A glTF is mapped instead of read, so import never holds a heap copy of its
+//! buffer data. A GLB's JSON chunk is parsed from the mapping and its BIN
+//! chunk, like the external `.bin` buffers of a `.gltf`, is handed to gltfio
+//! as resource data that points into the mapping.
+//!
+//! `EXT_meshopt_compression` buffer views are decoded here on worker threads
+//! and the JSON is rewritten to read them from plain buffers. Draco
+//! primitives are left to gltfio, and `KHR_mesh_quantization` needs nothing:
+//! gltfio uploads quantized attributes in their stored integer types.
+
+use crate::filament::{meshopt_decode_buffer_view, MeshoptFilter, MeshoptMode};
+use memmap2::Mmap;
+use serde::Deserialize;
+use std::fs::File;
+use std::io;
+use std::ops::Range;
+use std::path::Path;
+use std::sync::Arc;
+use std::time::{Duration, Instant};
+
+/// URI the BIN chunk of a GLB is registered under with the resource loader.
+const GLB_BIN_URI: &str = "previz-glb-bin";
+/// URI prefix for buffers holding decoded `EXT_meshopt_compression` views.
+const MESHOPT_URI_PREFIX: &str = "previz-meshopt-";
+
+const EXT_MESHOPT: &str = "EXT_meshopt_compression";
+const EXT_DRACO: &str = "KHR_draco_mesh_compression";
+const EXT_QUANTIZATION: &str = "KHR_mesh_quantization";
+
+const GLB_MAGIC: u32 = 0x4654_6C67;
+const GLB_CHUNK_JSON: u32 = 0x4E4F_534A;
+const GLB_CHUNK_BIN: u32 = 0x004E_4942;
+const GLB_HEADER_LEN: usize = 12;
+const GLB_CHUNK_HEADER_LEN: usize = 8;
+
+/// A glTF buffer served from a mapped file.
+pub struct MappedBuffer {
+    /// URI the buffer is referenced by in the glTF JSON.
+    pub uri: String,
+    pub mapping: Arc<Mmap>,
+    pub range: Range<usize>,
+}
+
+/// A glTF buffer produced at import, such as decoded meshopt views.
+pub struct DecodedBuffer {
+    pub uri: String,
+    pub data: Arc<Vec<u8>>,
+}
+
+/// Geometry compression used by a source and the decode work done on open.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct MeshCompression {
+    pub draco: bool,
+    pub meshopt: bool,
+    pub quantized: bool,
+    /// Buffer views decoded from `EXT_meshopt_compression`.
+    pub meshopt_views: usize,
+    pub meshopt_encoded_bytes: usize,
+    pub meshopt_decoded_bytes: usize,
+    pub meshopt_workers: usize,
+    pub meshopt_decode: Duration,
+}
+
+pub struct GltfSource {
+    json: SourceJson,
+    buffers: Vec<MappedBuffer>,
+    decoded: Vec<DecodedBuffer>,
+    compression: MeshCompression,
+}
+
+enum SourceJson {
+    /// A `.gltf` parsed straight from its mapping.
+    Mapped(Arc<Mmap>),
+    /// A GLB JSON chunk with its BIN buffer bound to `GLB_BIN_URI`, or JSON
+    /// rewritten after decoding meshopt views.
+    Owned(Vec<u8>),
+}
+
+#[derive(Deserialize)]
+#[serde(rename_all = "camelCase")]
+struct BufferList {
+    #[serde(default)]
+    buffers: Vec<BufferUri>,
+    #[serde(default)]
+    extensions_used: Vec<String>,
+}
+
+#[derive(Deserialize)]
+struct BufferUri {
+    uri: Option<String>,
+}
+
+impl GltfSource {
+    /// Map `path` and, for `.gltf` files, the external buffers it references.
+    /// Buffers that cannot be mapped are left for gltfio to read and report.
+    pub fn open(path: &Path) -> io::Result<Self> {
+        let mapping = Arc::new(map_file(path)?);
+        if is_glb(&mapping) {
+            let chunks = parse_glb(&mapping).map_err(invalid_data)?;
+            let mut document: serde_json::Value =
+                serde_json::from_slice(&mapping[chunks.json]).map_err(invalid_data)?;
+            bind_glb_buffer(&mut document);
+            let buffers: Vec<MappedBuffer> = chunks
+                .bin
+                .map(|range| MappedBuffer {
+                    uri: GLB_BIN_URI.to_string(),
+                    mapping: Arc::clone(&mapping),
+                    range,
+                })
+                .into_iter()
+                .collect();
+            let mut compression = detect_compression(&extensions_used(&document));
+            let decoded = decode_meshopt_views(path, &mut document, &buffers, &mut compression);
+            let json = serde_json::to_vec(&document).map_err(invalid_data)?;
+            return Ok(Self {
+                json: SourceJson::Owned(json),
+                buffers,
+                decoded,
+                compression,
+            });
+        }
+
+        let base = path.parent().unwrap_or_else(|| Path::new(""));
+        let list: BufferList = serde_json::from_slice(&mapping).map_err(invalid_data)?;
+        let mut compression = detect_compression(&list.extensions_used);
+        let mut buffers = Vec::new();
+        for uri in list.buffers.into_iter().filter_map(|buffer| buffer.uri) {
+            if !is_file_uri(&uri) || buffers.iter().any(|b: &MappedBuffer| b.uri == uri) {
+                continue;
+            }
+            let buffer_path = base.join(decode_uri(&uri));
+            match map_file(&buffer_path) {
+                Ok(buffer) => {
+                    let len = buffer.len();
+                    buffers.push(MappedBuffer {
+                        uri,
+                        mapping: Arc::new(buffer),
+                        range: 0..len,
+                    });
+                }
+                Err(err) => log::warn!("Failed mapping '{}': {}", buffer_path.display(), err),
+            }
+        }
+        if compression.meshopt {
+            let mut document: serde_json::Value =
+                serde_json::from_slice(&mapping).map_err(invalid_data)?;
+            let decoded = decode_meshopt_views(path, &mut document, &buffers, &mut compression);
+            if !decoded.is_empty() {
+                let json = serde_json::to_vec(&document).map_err(invalid_data)?;
+                return Ok(Self {
+                    json: SourceJson::Owned(json),
+                    buffers,
+                    decoded,
+                    compression,
+                });
+            }
+        }
+        Ok(Self {
+            json: SourceJson::Mapped(mapping),
+            buffers,
+            decoded: Vec::new(),
+            compression,
+        })
+    }
+
+    /// The glTF JSON to hand to the asset loader.
+    pub fn json(&self) -> &[u8] {
+        match &self.json {
+            SourceJson::Mapped(mapping) => &mapping[..],
+            SourceJson::Owned(json) => json.as_slice(),
+        }
+    }
+
+    pub fn buffers(&self) -> &[MappedBuffer] {
+        &self.buffers
+    }
+
+    pub fn decoded_buffers(&self) -> &[DecodedBuffer] {
+        &self.decoded
+    }
+
+    pub fn compression(&self) -> MeshCompression {
+        self.compression
+    }
+
+    /// The mappings backing buffer data. gltfio may read buffers again when it
+    /// adds instances, so these must live as long as the asset.
+    pub fn buffer_mappings(&self) -> Vec<Arc<Mmap>> {
+        let mut mappings: Vec<Arc<Mmap>> = Vec::new();
+        for buffer in &self.buffers {
+            if !mappings.iter().any(|m| Arc::ptr_eq(m, &buffer.mapping)) {
+                mappings.push(Arc::clone(&buffer.mapping));
+            }
+        }
+        mappings
+    }
+
+    /// Total size of the mapped files.
+    pub fn mapped_bytes(&self) -> usize {
+        let json = match &self.json {
+            SourceJson::Mapped(mapping) => mapping.len(),
+            SourceJson::Owned(_) => 0,
+        };
+        json + self
+            .buffer_mappings()
+            .iter()
+            .map(|mapping| mapping.len())
+            .sum::<usize>()
+    }
+}
+
+fn map_file(path: &Path) -> io::Result<Mmap> {
+    let file = File::open(path)?;
+    if file.metadata()?.len() == 0 {
+        return Err(invalid_data("file is empty"));
+    }
+    // Safety: the mapping is read-only; assets are not expected to be
+    // rewritten on disk while they are loaded.
+    unsafe { Mmap::map(&file) }
+}
+
+fn invalid_data(err: impl ToString) -> io::Error {
+    io::Error::new(io::ErrorKind::InvalidData, err.to_string())
+}
+
+#[derive(Debug, PartialEq, Eq)]
+struct GlbChunks {
+    json: Range<usize>,
+    bin: Option<Range<usize>>,
+}
+
+fn read_u32(bytes: &[u8], offset: usize) -> Option<u32> {
+    let word = bytes.get(offset..offset + 4)?;
+    Some(u32::from_le_bytes([word[0], word[1], word[2], word[3]]))
+}
+
+fn is_glb(bytes: &[u8]) -> bool {
+    read_u32(bytes, 0) == Some(GLB_MAGIC)
+}
+
+/// Locate the JSON and optional BIN chunks of a GLB container.
+fn parse_glb(bytes: &[u8]) -> Result<GlbChunks, String> {
+    if !is_glb(bytes) {
+        return Err("missing GLB magic".to_string());
+    }
+    let version = read_u32(bytes, 4).ok_or("truncated GLB header")?;
+    if version != 2 {
+        return Err(format!("unsupported GLB version {version}"));
+    }
+    let length = read_u32(bytes, 8).ok_or("truncated GLB header")? as usize;
+    if length > bytes.len() {
+        return Err(format!(
+            "GLB declares {length} bytes but the file has {}",
+            bytes.len()
+        ));
+    }
+
+    let mut json = None;
+    let mut bin = None;
+    let mut offset = GLB_HEADER_LEN;
+    while offset + GLB_CHUNK_HEADER_LEN <= length {
+        let chunk_len = read_u32(bytes, offset).ok_or("truncated GLB chunk")? as usize;
+        let chunk_type = read_u32(bytes, offset + 4).ok_or("truncated GLB chunk")?;
+        let start = offset + GLB_CHUNK_HEADER_LEN;
+        let end = start
+            .checked_add(chunk_len)
+            .filter(|&end| end <= length)
+            .ok_or("GLB chunk extends past the end of the file")?;
+        match chunk_type {
+            GLB_CHUNK_JSON if json.is_none() => json = Some(start..end),
+            // Only the first BIN chunk is addressable from the JSON.
+            GLB_CHUNK_BIN if json.is_some() && bin.is_none() => bin = Some(start..end),
+            _ => {}
+        }
+        offset = end;
+    }
+    let json = json.ok_or("GLB has no JSON chunk")?;
+    Ok(GlbChunks { json, bin })
+}
+
+/// Give the GLB's BIN buffer (the first buffer, without a URI) a URI so
+/// gltfio resolves it through resource data instead of a copy of the file.
+fn bind_glb_buffer(document: &mut serde_json::Value) {
+    if let Some(buffer) = document
+        .get_mut("buffers")
+        .and_then(|buffers| buffers.get_mut(0))
+        .and_then(|buffer| buffer.as_object_mut())
+    {
+        if !buffer.contains_key("uri") {
+            buffer.insert("uri".to_string(), GLB_BIN_URI.into());
+        }
+    }
+}
+
+fn extensions_used(document: &serde_json::Value) -> Vec<String> {
+    document
+        .get("extensionsUsed")
+        .and_then(|used| used.as_array())
+        .map(|used| {
+            used.iter()
+                .filter_map(|name| name.as_str().map(str::to_string))
+                .collect()
+        })
+        .unwrap_or_default()
+}
+
+fn detect_compression(extensions_used: &[String]) -> MeshCompression {
+    let uses = |name: &str| extensions_used.iter().any(|used| used == name);
+    MeshCompression {
+        draco: uses(EXT_DRACO),
+        meshopt: uses(EXT_MESHOPT),
+        quantized: uses(EXT_QUANTIZATION),
+        ..MeshCompression::default()
+    }
+}
+
+/// The `EXT_meshopt_compression` object on a buffer view.
+#[derive(Deserialize)]
+#[serde(rename_all = "camelCase")]
+struct MeshoptExtension {
+    buffer: usize,
+    #[serde(default)]
+    byte_offset: usize,
+    byte_length: usize,
+    byte_stride: usize,
+    count: usize,
+    mode: String,
+    #[serde(default)]
+    filter: Option<String>,
+}
+
+/// One compressed view: where its encoded bytes are and where they decode to.
+struct MeshoptView {
+    view: usize,
+    target_buffer: usize,
+    target: Range<usize>,
+    source: Range<usize>,
+    source_uri: String,
+    count: usize,
+    stride: usize,
+    mode: MeshoptMode,
+    filter: MeshoptFilter,
+}
+
+/// Decode every `EXT_meshopt_compression` view whose target is a fallback
+/// buffer, in parallel, and rewrite `document` to read the results as plain
+/// buffers. Views that target a real buffer already have uncompressed data
+/// there and only lose the extension. On any failure the document is left
+/// untouched for gltfio to decode.
+fn decode_meshopt_views(
+    path: &Path,
+    document: &mut serde_json::Value,
+    buffers: &[MappedBuffer],
+    compression: &mut MeshCompression,
+) -> Vec<DecodedBuffer> {
+    if !compression.meshopt {
+        return Vec::new();
+    }
+    let start = Instant::now();
+    let result = collect_meshopt_views(document, buffers)
+        .and_then(|views| decode_views(document, buffers, views, compression));
+    match result {
+        Ok(decoded) => {
+            compression.meshopt_decode = start.elapsed();
+            decoded
+        }
+        Err(err) => {
+            log::warn!(
+                "Leaving {} in '{}' to gltfio: {}",
+                EXT_MESHOPT,
+                path.display(),
+                err
+            );
+            Vec::new()
+        }
+    }
+}
+
+fn collect_meshopt_views(
+    document: &serde_json::Value,
+    buffers: &[MappedBuffer],
+) -> Result<Vec<MeshoptView>, String> {
+    let buffer_uri = |index: usize| {
+        document
+            .get("buffers")
+            .and_then(|list| list.get(index))
+            .and_then(|buffer| buffer.get("uri"))
+            .and_then(|uri| uri.as_str())
+    };
+    let mut views = Vec::new();
+    let Some(list) = document.get("bufferViews").and_then(|list| list.as_array()) else {
+        return Ok(views);
+    };
+    for (index, view) in list.iter().enumerate() {
+        let Some(extension) = view.get("extensions").and_then(|ext| ext.get(EXT_MESHOPT)) else {
+            continue;
+        };
+        let extension = MeshoptExtension::deserialize(extension)
+            .map_err(|err| format!("buffer view {index}: {err}"))?;
+        let mode = match extension.mode.as_str() {
+            "ATTRIBUTES" => MeshoptMode::Attributes,
+            "TRIANGLES" => MeshoptMode::Triangles,
+            "INDICES" => MeshoptMode::Indices,
+            other => return Err(format!("buffer view {index}: unknown mode '{other}'")),
+        };
+        let filter = match extension.filter.as_deref().unwrap_or("NONE") {
+            "NONE" => MeshoptFilter::None,
+            "OCTAHEDRAL" => MeshoptFilter::Octahedral,
+            "QUATERNION" => MeshoptFilter::Quaternion,
+            "EXPONENTIAL" => MeshoptFilter::Exponential,
+            other => return Err(format!("buffer view {index}: unknown filter '{other}'")),
+        };
+        let source_uri = buffer_uri(extension.buffer)
+            .filter(|uri| buffers.iter().any(|buffer| buffer.uri == *uri))
+            .ok_or_else(|| format!("buffer view {index}: compressed buffer is not mapped"))?;
+        let target_buffer = view
+            .get("buffer")
+            .and_then(|buffer| buffer.as_u64())
+            .ok_or_else(|| format!("buffer view {index}: missing buffer"))?
+            as usize;
+        let target_offset = view
+            .get("byteOffset")
+            .and_then(|offset| offset.as_u64())
+            .unwrap_or(0) as usize;
+        let target_len = extension
+            .count
+            .checked_mul(extension.byte_stride)
+            .ok_or_else(|| format!("buffer view {index}: size overflows"))?;
+        views.push(MeshoptView {
+            view: index,
+            target_buffer,
+            target: target_offset..target_offset + target_len,
+            source: extension.byte_offset..extension.byte_offset + extension.byte_length,
+            source_uri: source_uri.to_string(),
+            count: extension.count,
+            stride: extension.byte_stride,
+            mode,
+            filter,
+        });
+    }
+    Ok(views)
+}
+
+/// Whether buffer `index` is a placeholder that only exists to receive
+/// decoded data (no URI, or marked as a meshopt fallback).
+fn is_fallback_buffer(document: &serde_json::Value, index: usize) -> bool {
+    let Some(buffer) = document.get("buffers").and_then(|list| list.get(index)) else {
+        return false;
+    };
+    let marked = buffer
+        .get("extensions")
+        .and_then(|ext| ext.get(EXT_MESHOPT))
+        .and_then(|ext| ext.get("fallback"))
+        .and_then(|fallback| fallback.as_bool())
+        .unwrap_or(false);
+    marked || buffer.get("uri").is_none()
+}
+
+fn decode_views(
+    document: &mut serde_json::Value,
+    buffers: &[MappedBuffer],
+    mut views: Vec<MeshoptView>,
+    compression: &mut MeshCompression,
+) -> Result<Vec<DecodedBuffer>, String> {
+    // Allocate each fallback buffer once, then carve it into disjoint
+    // destinations so workers can decode straight into it.
+    views.sort_by_key(|view| (view.target_buffer, view.target.start));
+    let mut targets: Vec<(usize, Vec<u8>)> = Vec::new();
+    for view in &views {
+        if !is_fallback_buffer(document, view.target_buffer)
+            || targets
+                .iter()
+                .any(|(index, _)| *index == view.target_buffer)
+        {
+            continue;
+        }
+        let byte_length = document["buffers"][view.target_buffer]
+            .get("byteLength")
+            .and_then(|len| len.as_u64())
+            .ok_or_else(|| format!("buffer {} has no byteLength", view.target_buffer))?;
+        targets.push((view.target_buffer, vec![0; byte_length as usize]));
+    }
+
+    let mut jobs = Vec::new();
+    for (buffer_index, data) in targets.iter_mut() {
+        let mut rest: &mut [u8] = data.as_mut_slice();
+        let mut consumed = 0;
+        for view in views
+            .iter()
+            .filter(|view| view.target_buffer == *buffer_index)
+        {
+            if view.target.start < consumed || view.target.end - consumed > rest.len() {
+                return Err(format!(
+                    "buffer view {} overlaps or exceeds buffer {}",
+                    view.view, buffer_index
+                ));
+            }
+            let (_, tail) = std::mem::take(&mut rest).split_at_mut(view.target.start - consumed);
+            let (dst, tail) = tail.split_at_mut(view.target.len());
+            rest = tail;
+            consumed = view.target.end;
+            let source = buffers
+                .iter()
+                .find(|buffer| buffer.uri == view.source_uri)
+                .map(|buffer| &buffer.mapping[buffer.range.clone()])
+                .and_then(|bytes| bytes.get(view.source.clone()))
+                .ok_or_else(|| {
+                    format!("buffer view {}: compressed range out of bounds", view.view)
+                })?;
+            jobs.push((view, source, dst));
+        }
+    }
+
+    let workers = std::thread::available_parallelism()
+        .map(|count| count.get())
+        .unwrap_or(1)
+        .min(jobs.len())
+        .max(1);
+    compression.meshopt_views = jobs.len();
+    compression.meshopt_workers = workers;
+    compression.meshopt_encoded_bytes = jobs.iter().map(|(_, src, _)| src.len()).sum();
+    compression.meshopt_decoded_bytes = jobs.iter().map(|(_, _, dst)| dst.len()).sum();
+
+    // Deal the largest views first, round robin, to balance the workers.
+    jobs.sort_by_key(|(_, _, dst)| std::cmp::Reverse(dst.len()));
+    let mut batches: Vec<Vec<_>> = (0..workers).map(|_| Vec::new()).collect();
+    for (index, job) in jobs.into_iter().enumerate() {
+        batches[index % workers].push(job);
+    }
+    let failed: Vec<usize> = std::thread::scope(|scope| {
+        let handles: Vec<_> = batches
+            .into_iter()
+            .map(|batch| {
+                scope.spawn(move || {
+                    let mut failed = Vec::new();
+                    for (view, src, dst) in batch {
+                        let ok = meshopt_decode_buffer_view(
+                            view.mode,
+                            view.filter,
+                            view.count,
+                            view.stride,
+                            src,
+                            dst,
+                        );
+                        if !ok {
+                            failed.push(view.view);
+                        }
+                    }
+                    failed
+                })
+            })
+            .collect();
+        handles
+            .into_iter()
+            .flat_map(|handle| handle.join().expect("meshopt decode worker panicked"))
+            .collect()
+    });
+    if let Some(view) = failed.first() {
+        return Err(format!("buffer view {view} failed to decode"));
+    }
+
+    // Everything decoded; point the JSON at the results.
+    for view in &views {
+        remove_extension(&mut document["bufferViews"][view.view]);
+    }
+    let mut decoded = Vec::with_capacity(targets.len());
+    for (index, data) in targets {
+        let uri = format!("{MESHOPT_URI_PREFIX}{index}");
+        let buffer = &mut document["buffers"][index];
+        remove_extension(buffer);
+        buffer["uri"] = uri.clone().into();
+        decoded.push(DecodedBuffer {
+            uri,
+            data: Arc::new(data),
+        });
+    }
+    for key in ["extensionsUsed", "extensionsRequired"] {
+        if let Some(list) = document.get_mut(key).and_then(|list| list.as_array_mut()) {
+            list.retain(|name| name.as_str() != Some(EXT_MESHOPT));
+        }
+    }
+    Ok(decoded)
+}
+
+fn remove_extension(object: &mut serde_json::Value) {
+    let Some(map) = object.as_object_mut() else {
+        return;
+    };
+    let now_empty = map
+        .get_mut("extensions")
+        .and_then(|ext| ext.as_object_mut())
+        .map(|ext| {
+            ext.remove(EXT_MESHOPT);
+            ext.is_empty()
+        })
+        .unwrap_or(false);
+    if now_empty {
+        map.remove("extensions");
+    }
+}
+
+/// Whether `uri` names a file relative to the glTF (not a data or remote URI).
+fn is_file_uri(uri: &str) -> bool {
+    !uri.is_empty() && !uri.starts_with("data:") && !uri.contains("://")
+}
+
+/// Undo percent-encoding in a relative URI.
+fn decode_uri(uri: &str) -> String {
+    let bytes = uri.as_bytes();
+    let mut decoded = Vec::with_capacity(bytes.len());
+    let mut index = 0;
+    while index < bytes.len() {
+        if bytes[index] == b'%' {
+            let hex = uri.get(index + 1..index + 3);
+            if let Some(value) = hex.and_then(|hex| u8::from_str_radix(hex, 16).ok()) {
+                decoded.push(value);
+                index += 3;
+                continue;
+            }
+        }
+        decoded.push(bytes[index]);
+        index += 1;
+    }
+    String::from_utf8_lossy(&decoded).into_owned()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn glb(json: &str, bin: Option<&[u8]>) -> Vec<u8> {
+        let mut json = json.as_bytes().to_vec();
+        while json.len() % 4 != 0 {
+            json.push(b' ');
+        }
+        let mut body = Vec::new();
+        body.extend_from_slice(&(json.len() as u32).to_le_bytes());
+        body.extend_from_slice(&GLB_CHUNK_JSON.to_le_bytes());
+        body.extend_from_slice(&json);
+        if let Some(bin) = bin {
+            body.extend_from_slice(&(bin.len() as u32).to_le_bytes());
+            body.extend_from_slice(&GLB_CHUNK_BIN.to_le_bytes());
+            body.extend_from_slice(bin);
+        }
+        let mut bytes = Vec::new();
+        bytes.extend_from_slice(&GLB_MAGIC.to_le_bytes());
+        bytes.extend_from_slice(&2u32.to_le_bytes());
+        bytes.extend_from_slice(&((GLB_HEADER_LEN + body.len()) as u32).to_le_bytes());
+        bytes.extend_from_slice(&body);
+        bytes
+    }
+
+    #[test]
+    fn glb_chunks_are_located_in_place() {
+        let bytes = glb(r#"{"buffers":[{"byteLength":4}]}"#, Some(&[1, 2, 3, 4]));
+        let chunks = parse_glb(&bytes).expect("valid glb");
+        assert_eq!(&bytes[chunks.bin.clone().unwrap()], &[1, 2, 3, 4]);
+        let mut document: serde_json::Value = serde_json::from_slice(&bytes[chunks.json]).unwrap();
+        bind_glb_buffer(&mut document);
+        assert_eq!(document["buffers"][0]["uri"], GLB_BIN_URI);
+        assert_eq!(document["buffers"][0]["byteLength"], 4);
+
+        assert!(parse_glb(&glb("{}", None)).unwrap().bin.is_none());
+        assert!(parse_glb(b"{\"asset\":{}}").is_err());
+        let mut truncated = glb("{}", Some(&[0; 8]));
+        truncated.truncate(truncated.len() - 4);
+        assert!(parse_glb(&truncated).is_err());
+    }
+
+    #[test]
+    fn meshopt_views_target_fallback_buffers() {
+        let mut document: serde_json::Value = serde_json::from_str(
+            r#"{
+                "extensionsUsed": ["EXT_meshopt_compression", "KHR_mesh_quantization"],
+                "extensionsRequired": ["EXT_meshopt_compression"],
+                "buffers": [
+                    {"byteLength": 64},
+                    {"byteLength": 96, "extensions": {"EXT_meshopt_compression": {"fallback": true}}}
+                ],
+                "bufferViews": [
+                    {"buffer": 1, "byteOffset": 32, "byteLength": 64, "byteStride": 8,
+                     "extensions": {"EXT_meshopt_compression": {
+                        "buffer": 0, "byteOffset": 16, "byteLength": 40, "byteStride": 8,
+                        "count": 8, "mode": "ATTRIBUTES", "filter": "OCTAHEDRAL"}}}
+                ]
+            }"#,
+        )
+        .unwrap();
+        bind_glb_buffer(&mut document);
+        let compression = detect_compression(&extensions_used(&document));
+        assert!(compression.meshopt && compression.quantized && !compression.draco);
+
+        let bin = MappedBuffer {
+            uri: GLB_BIN_URI.to_string(),
+            mapping: Arc::new(
+                memmap2::MmapOptions::new()
+                    .len(64)
+                    .map_anon()
+                    .unwrap()
+                    .make_read_only()
+                    .unwrap(),
+            ),
+            range: 0..64,
+        };
+        let views = collect_meshopt_views(&document, &[bin]).expect("valid views");
+        assert_eq!(views.len(), 1);
+        assert_eq!(views[0].target, 32..96);
+        assert_eq!(views[0].source, 16..56);
+        assert_eq!(views[0].filter, MeshoptFilter::Octahedral);
+        assert!(is_fallback_buffer(&document, 1));
+        assert!(!is_fallback_buffer(&document, 0));
+        assert!(collect_meshopt_views(&document, &[]).is_err());
+
+        remove_extension(&mut document["bufferViews"][0]);
+        assert!(document["bufferViews"][0].get("extensions").is_none());
+    }
+
+    #[test]
+    fn buffer_uris_resolve_to_files() {
+        assert!(is_file_uri("mesh.bin"));
+        assert!(!is_file_uri("data:application/octet-stream;base64,AAAA"));
+        assert!(!is_file_uri("https://example.com/mesh.bin"));
+        assert_eq!(decode_uri("my%20mesh.bin"), "my mesh.bin");
+        assert_eq!(decode_uri("100%.bin"), "100%.bin");
+    }
+}
@@ -1,8 +1,53 @@
+mod gltf_source;
+
 use crate::filament::{
-    Engine, Entity, EntityManager, GltfAsset, GltfAssetLoader, GltfMaterialProvider,
-    GltfResourceLoader, GltfTextureProvider, MaterialInstance, Scene,
+    Engine, Entity, EntityManager, Fence, FenceStatus, GltfAsset, GltfAssetLoader, GltfInstance,
+    GltfMaterialProvider, GltfResourceLoader, GltfTextureProvider, MaterialInstance, Scene,
+    TextureDecodeStats,
 };
+use gltf_source::GltfSource;
+use memmap2::Mmap;
+use std::collections::HashMap;
 use std::path::PathBuf;
+use std::sync::Arc;
+use std::time::{Duration, Instant};
+
+/// Precompiled ubershader archive staged by build.rs; empty selects gltfio's default.
+const UBERSHADER_ARCHIVE: &[u8] = include_bytes!(concat!(env!("OUT_DIR"), "/ubershader.uberz"));
+
+/// Decoded PNG/JPEG images the texture provider may hold before upload; a
+/// 4K RGBA image is 64 MiB.
+const TEXTURE_DECODE_MAX_RESIDENT: u32 = 8;
+
+/// Frames a retired batch waits before release even once its fence has
+/// signaled; covers Filament's frames in flight on the driver thread.
+const RETIRE_MIN_FRAMES: u32 = 3;
+
+/// Which gltfio material provider builds glTF materials.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum MaterialProviderKind {
+    /// Generate and compile a material per glTF feature set at load time.
+    Jit,
+    /// Pick from a precompiled ubershader archive; no shader compilation.
+    Ubershader,
+}
+
+impl MaterialProviderKind {
+    pub fn from_str(value: &str) -> Option<Self> {
+        match value.trim().to_ascii_lowercase().as_str() {
+            "jit" => Some(Self::Jit),
+            "ubershader" | "uber" => Some(Self::Ubershader),
+            _ => None,
+        }
+    }
+
+    pub fn as_str(self) -> &'static str {
+        match self {
+            Self::Jit => "jit",
+            Self::Ubershader => "ubershader",
+        }
+    }
+}
 
 #[derive(Debug, Clone)]
 pub struct LoadedAsset {
@@ -12,6 +57,53 @@ pub struct LoadedAsset {
     pub root_entity: Entity,
     /// All renderable sub-entities (for GPU pick pass).
     pub renderable_entities: Vec<Entity>,
+    /// True when this load added an instance to an asset already loaded from
+    /// the same path instead of parsing and uploading it again.
+    pub instanced: bool,
+    pub timings: AssetLoadTimings,
+}
+
+/// Wall-clock breakdown of one glTF load.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct AssetLoadTimings {
+    /// Creating or resetting the shared asset/resource loaders.
+    pub loader_setup: Duration,
+    pub read: Duration,
+    pub parse: Duration,
+    /// Buffer and texture loading; for asynchronous loads, begin to completion.
+    pub resources: Duration,
+    /// Adding entities to the scene and collecting material instances.
+    pub finalize: Duration,
+}
+
+impl AssetLoadTimings {
+    pub fn total(&self) -> Duration {
+        self.loader_setup + self.read + self.parse + self.resources + self.finalize
+    }
+
+    pub fn accumulate(&mut self, other: &Self) {
+        self.loader_setup += other.loader_setup;
+        self.read += other.read;
+        self.parse += other.parse;
+        self.resources += other.resources;
+        self.finalize += other.finalize;
+    }
+}
+
+impl std::fmt::Display for AssetLoadTimings {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        let ms = |value: Duration| value.as_secs_f64() * 1000.0;
+        write!(
+            f,
+            "setup {:.2} ms, read {:.2} ms, parse {:.2} ms, resources {:.2} ms, finalize {:.2} ms (total {:.2} ms)",
+            ms(self.loader_setup),
+            ms(self.read),
+            ms(self.parse),
+            ms(self.resources),
+            ms(self.finalize),
+            ms(self.total())
+        )
+    }
 }
 
 #[derive(Debug, Clone)]
@@ -22,17 +114,146 @@ pub struct MaterialBinding {
     pub object_id: u64,
 }
 
+/// Timing and progress for one asynchronous glTF load.
+#[derive(Debug, Clone, Copy)]
+pub struct AssetLoadStats {
+    /// Frames the load was pumped for.
+    pub frames: u32,
+    pub elapsed: Duration,
+    /// Last progress fraction reported by the resource loader.
+    pub progress: f32,
+}
+
+/// An asynchronous glTF load that finished and was added to the scene.
+/// gltfio reports no per-resource errors here; failures surface from
+/// `begin_gltf_load`.
+#[derive(Debug)]
+pub struct CompletedAssetLoad {
+    pub object_id: u64,
+    pub path: String,
+    pub asset: LoadedAsset,
+    pub stats: AssetLoadStats,
+}
+
+/// A glTF file mapped, parsed and meshopt-decoded off the engine thread by
+/// `AssetManager::prepare_gltf`. Staged with `stage_prepared`, it replaces the
+/// read and parse of the next load of its path.
+pub struct PreparedGltf {
+    gltf_path: PathBuf,
+    source: Result<GltfSource, AssetError>,
+    read: Duration,
+}
+
+/// The asset (and instance, for instanced assets) a scene object was loaded as.
+struct AssetObject {
+    object_id: u64,
+    asset_index: usize,
+    instance: Option<GltfInstance>,
+    path: String,
+}
+
+/// A glTF asset with the mapped files and decoded buffers gltfio serves its
+/// buffers from in place. They are read again when instances are added, so
+/// they live exactly as long as the asset and drop after it.
+struct StoredAsset {
+    asset: GltfAsset,
+    _mappings: Vec<Arc<Mmap>>,
+    _decoded_buffers: Vec<Arc<Vec<u8>>>,
+}
+
+/// Resources taken out of the scene but possibly still referenced by frames
+/// in flight. Material instances drop before the assets owning them.
+#[derive(Default)]
+struct RetiredResources {
+    material_instances: Vec<MaterialInstance>,
+    assets: Vec<StoredAsset>,
+}
+
+impl RetiredResources {
+    fn len(&self) -> usize {
+        self.material_instances.len() + self.assets.len()
+    }
+
+    fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/// Resources retired between two `collect_retired` calls, released once
+/// `fence` signals. A batch without a fence waits on the frame count alone.
+struct RetiredBatch {
+    generation: u64,
+    fence: Option<Fence>,
+    frames: u32,
+    resources: RetiredResources,
+}
+
+struct PendingAssetLoad {
+    object_id: u64,
+    path: String,
+    source: PathBuf,
+    asset: StoredAsset,
+    resource_loader: GltfResourceLoader,
+    timings: AssetLoadTimings,
+    started: Instant,
+    frames: u32,
+    progress: f32,
+}
+
+/// A load of a path whose asset is already loaded or loading; resolved into
+/// a new instance once the source asset is ready.
+struct QueuedInstance {
+    object_id: u64,
+    path: String,
+    source: PathBuf,
+    queued: Instant,
+    frames: u32,
+}
+
+impl PendingAssetLoad {
+    fn stats(&self) -> AssetLoadStats {
+        AssetLoadStats {
+            frames: self.frames,
+            elapsed: self.started.elapsed(),
+            progress: self.progress,
+        }
+    }
+}
+
 pub struct AssetManager {
-    // Store all loaded assets to keep them alive (prevent Drop from destroying entities)
-    gltf_assets: Vec<GltfAsset>,
-    retired_gltf_assets: Vec<GltfAsset>,
+    // Store all loaded assets to keep them alive (prevent Drop from destroying entities).
+    // Slots are emptied when an asset is retired so indices stay stable.
+    gltf_assets: Vec<Option<StoredAsset>>,
     loaded_assets: Vec<LoadedAsset>,
     material_instances: Vec<MaterialInstance>,
-    retired_material_instances: Vec<MaterialInstance>,
     material_bindings: Vec<MaterialBinding>,
+    // Root entity -> index into `loaded_assets`, and (object id, material
+    // slot) -> index into `material_instances`. Rebuilt when removal shifts
+    // either vector.
+    loaded_by_root: HashMap<Entity, usize>,
+    material_slots: HashMap<(u64, usize), usize>,
+    objects: Vec<AssetObject>,
+    pending_loads: Vec<PendingAssetLoad>,
+    queued_instances: Vec<QueuedInstance>,
+    // Resolved source path -> index into `gltf_assets`. Repeated paths add
+    // instances to the first asset, sharing its buffers and textures.
+    instanced_sources: HashMap<PathBuf, usize>,
+    // Loaders are shared by every load. The asset loader must outlive the
+    // assets it created; idle resource loaders are reset before reuse.
+    asset_loader: Option<GltfAssetLoader>,
+    idle_resource_loaders: Vec<GltfResourceLoader>,
+    // Sources prepared ahead of their load, keyed by resolved glTF path.
+    prepared_sources: HashMap<PathBuf, PreparedGltf>,
+    // Resources retired since the last `collect_retired`, then fenced batches
+    // oldest first.
+    retiring: RetiredResources,
+    retired_batches: Vec<RetiredBatch>,
+    retire_generation: u64,
     // glTF providers must outlive loaded assets/material instances.
+    material_provider_kind: MaterialProviderKind,
     material_provider: Option<GltfMaterialProvider>,
     texture_provider: Option<GltfTextureProvider>,
+    ktx2_texture_provider: Option<GltfTextureProvider>,
 }
 
 #[derive(Debug, thiserror::Error)]
@@ -61,14 +282,51 @@ impl AssetManager {
     pub fn new() -> Self {
         Self {
             gltf_assets: Vec::new(),
-            retired_gltf_assets: Vec::new(),
             loaded_assets: Vec::new(),
             material_instances: Vec::new(),
-            retired_material_instances: Vec::new(),
             material_bindings: Vec::new(),
+            loaded_by_root: HashMap::new(),
+            material_slots: HashMap::new(),
+            objects: Vec::new(),
+            pending_loads: Vec::new(),
+            queued_instances: Vec::new(),
+            instanced_sources: HashMap::new(),
+            asset_loader: None,
+            idle_resource_loaders: Vec::new(),
+            prepared_sources: HashMap::new(),
+            retiring: RetiredResources::default(),
+            retired_batches: Vec::new(),
+            retire_generation: 0,
+            material_provider_kind: MaterialProviderKind::Jit,
             material_provider: None,
             texture_provider: None,
+            ktx2_texture_provider: None,
+        }
+    }
+
+    pub fn material_provider_kind(&self) -> MaterialProviderKind {
+        self.material_provider_kind
+    }
+
+    /// Select the material provider. The provider is created on the first load
+    /// and kept for the manager's lifetime, so this must be called before then.
+    pub fn set_material_provider_kind(&mut self, kind: MaterialProviderKind) {
+        if self.material_provider.is_some() && kind != self.material_provider_kind {
+            log::warn!(
+                "Material provider already created as '{}'; ignoring switch to '{}'.",
+                self.material_provider_kind.as_str(),
+                kind.as_str()
+            );
+            return;
         }
+        self.material_provider_kind = kind;
+    }
+
+    /// Counters from the shared texture provider, accumulated over all loads.
+    pub fn texture_decode_stats(&self) -> Option<TextureDecodeStats> {
+        self.texture_provider
+            .as_ref()
+            .and_then(|provider| provider.decode_stats())
     }
 
     pub fn loaded_assets(&self) -> &[LoadedAsset] {
@@ -87,14 +345,207 @@ impl AssetManager {
         self.material_bindings.get(index)
     }
 
-    /// Prepare for scene rebuild without dropping native glTF/material resources mid-frame.
-    /// Old resources are retained until full teardown.
-    pub fn prepare_for_scene_rebuild(&mut self) {
-        self.retired_material_instances
-            .append(&mut self.material_instances);
-        self.retired_gltf_assets.append(&mut self.gltf_assets);
-        self.loaded_assets.clear();
-        self.material_bindings.clear();
+    /// Index into `material_instances` of scene object `object_id`'s material
+    /// `slot`.
+    pub fn material_index(&self, object_id: u64, slot: usize) -> Option<usize> {
+        self.material_slots.get(&(object_id, slot)).copied()
+    }
+
+    /// The loaded asset whose root is `root_entity`.
+    pub fn loaded_asset(&self, root_entity: Entity) -> Option<&LoadedAsset> {
+        self.loaded_by_root
+            .get(&root_entity)
+            .and_then(|&index| self.loaded_assets.get(index))
+    }
+
+    /// Path of the asset loaded for scene object `object_id`, if any.
+    pub fn object_path(&self, object_id: u64) -> Option<&str> {
+        self.objects
+            .iter()
+            .find(|object| object.object_id == object_id)
+            .map(|object| object.path.as_str())
+    }
+
+    /// Take the asset loaded for `object_id` out of `scene` without dropping
+    /// native resources mid-frame: its material instances are retired, and the
+    /// glTF asset is retired once no other object instances it. Retired
+    /// resources are released by `collect_retired`. gltfio cannot
+    /// destroy a single instance, so an instance of a still-used asset is only
+    /// detached. Returns false if the object has no loaded asset.
+    pub fn remove_object(&mut self, object_id: u64, scene: &mut Scene) -> bool {
+        let Some(position) = self
+            .objects
+            .iter()
+            .position(|object| object.object_id == object_id)
+        else {
+            return false;
+        };
+        let object = self.objects.remove(position);
+        let asset = self
+            .gltf_assets
+            .get_mut(object.asset_index)
+            .and_then(Option::as_mut)
+            .map(|stored| &mut stored.asset);
+        let root_entity = match (&object.instance, asset) {
+            (Some(instance), _) => {
+                instance.remove_entities_from_scene(scene);
+                Some(instance.root_entity())
+            }
+            (None, Some(asset)) => {
+                asset.remove_entities_from_scene(scene);
+                Some(asset.root_entity())
+            }
+            (None, None) => None,
+        };
+        if let Some(root_entity) = root_entity {
+            self.loaded_assets
+                .retain(|loaded| loaded.root_entity != root_entity);
+        }
+
+        let mut index = 0;
+        while index < self.material_bindings.len() {
+            if self.material_bindings[index].object_id != object_id {
+                index += 1;
+                continue;
+            }
+            self.material_bindings.remove(index);
+            let instance = self.material_instances.remove(index);
+            self.retiring.material_instances.push(instance);
+        }
+        self.reindex();
+
+        let asset_in_use = self
+            .objects
+            .iter()
+            .any(|other| other.asset_index == object.asset_index);
+        if !asset_in_use {
+            if let Some(asset) = self
+                .gltf_assets
+                .get_mut(object.asset_index)
+                .and_then(Option::take)
+            {
+                self.instanced_sources
+                    .retain(|_, index| *index != object.asset_index);
+                self.retiring.assets.push(asset);
+            }
+        }
+        true
+    }
+
+    fn reindex(&mut self) {
+        self.loaded_by_root = self
+            .loaded_assets
+            .iter()
+            .enumerate()
+            .map(|(index, loaded)| (loaded.root_entity, index))
+            .collect();
+        self.material_slots = self
+            .material_bindings
+            .iter()
+            .enumerate()
+            .map(|(index, binding)| ((binding.object_id, binding.material_slot), index))
+            .collect();
+    }
+
+    /// Fence the resources retired since the last call and release batches
+    /// whose fence has signaled at least `RETIRE_MIN_FRAMES` calls ago. Call
+    /// once per frame; nothing here waits on the GPU.
+    pub fn collect_retired(&mut self, engine: &mut Engine) {
+        for batch in &mut self.retired_batches {
+            batch.frames = batch.frames.saturating_add(1);
+        }
+        if !self.retiring.is_empty() {
+            self.retire_generation += 1;
+            let fence = engine.create_fence();
+            if fence.is_none() {
+                log::warn!(
+                    "Failed to create fence for retired generation {}; releasing by frame count",
+                    self.retire_generation
+                );
+            }
+            self.retired_batches.push(RetiredBatch {
+                generation: self.retire_generation,
+                fence,
+                frames: 0,
+                resources: std::mem::take(&mut self.retiring),
+            });
+        }
+        // Fences signal in submission order, so stop at the first pending batch.
+        while let Some(batch) = self.retired_batches.first() {
+            if batch.frames < RETIRE_MIN_FRAMES {
+                break;
+            }
+            match batch.fence.as_ref().map(Fence::poll) {
+                Some(FenceStatus::Pending) => break,
+                Some(FenceStatus::Error) => log::warn!(
+                    "Fence for retired generation {} failed; releasing after {} frames",
+                    batch.generation,
+                    batch.frames
+                ),
+                Some(FenceStatus::Signaled) | None => {}
+            }
+            let batch = self.retired_batches.remove(0);
+            log::debug!(
+                "Released retired generation {}: {} resources after {} frames",
+                batch.generation,
+                batch.resources.len(),
+                batch.frames
+            );
+        }
+    }
+
+    /// Retired resources not yet released, including those awaiting a fence.
+    pub fn retired_resource_count(&self) -> usize {
+        self.retiring.len()
+            + self
+                .retired_batches
+                .iter()
+                .map(|batch| batch.resources.len())
+                .sum::<usize>()
+    }
+
+    /// Map, parse and decode the glTF at `path` without touching the engine;
+    /// safe to call from any thread.
+    pub fn prepare_gltf(path: &str) -> PreparedGltf {
+        let start = Instant::now();
+        let source = open_gltf_source(path).map(|(_, source)| source);
+        PreparedGltf {
+            gltf_path: resolve_gltf_path(path),
+            source,
+            read: start.elapsed(),
+        }
+    }
+
+    /// Whether loading `path` would read it, rather than instance an asset
+    /// already loaded from the same file.
+    pub fn needs_source(&self, path: &str) -> bool {
+        !self.instanced_sources.contains_key(&source_key(path))
+    }
+
+    /// Hand a prepared source to the next load of its path.
+    pub fn stage_prepared(&mut self, prepared: PreparedGltf) {
+        self.prepared_sources
+            .insert(prepared.gltf_path.clone(), prepared);
+    }
+
+    /// Drop prepared sources no load consumed.
+    pub fn clear_prepared(&mut self) {
+        self.prepared_sources.clear();
+    }
+
+    pub fn has_pending_loads(&self) -> bool {
+        !self.pending_loads.is_empty() || !self.queued_instances.is_empty()
+    }
+
+    /// Number of pending loads and their mean progress fraction, or `None` when idle.
+    /// Queued instances count as not started until their source asset is ready.
+    pub fn load_progress(&self) -> Option<(usize, f32)> {
+        let pending = self.pending_loads.len() + self.queued_instances.len();
+        if pending == 0 {
+            return None;
+        }
+        let total: f32 = self.pending_loads.iter().map(|load| load.progress).sum();
+        Some((pending, total / pending as f32))
     }
 
     pub fn load_gltf_from_path(
@@ -105,62 +556,385 @@ impl AssetManager {
         path: &str,
         object_id: u64,
     ) -> Result<LoadedAsset, AssetError> {
-        let (gltf_path, gltf_bytes) = load_gltf_bytes(path)?;
-        if self.material_provider.is_none() {
-            self.material_provider = GltfMaterialProvider::create_jit(engine, false);
+        let source = source_key(path);
+        if let Some(&index) = self.instanced_sources.get(&source) {
+            if let Some(loaded) = self.instantiate(index, scene, path, object_id) {
+                return Ok(loaded);
+            }
         }
-        if self.texture_provider.is_none() {
-            self.texture_provider = GltfTextureProvider::create_stb(engine);
+        let (mut resource_loader, mut asset, mut timings) =
+            self.create_gltf_asset(engine, entity_manager, path)?;
+        let resources_start = Instant::now();
+        let loaded = resource_loader.load_resources(&mut asset.asset);
+        timings.resources = resources_start.elapsed();
+        self.release_resource_loader(resource_loader);
+        if !loaded {
+            return Err(AssetError::LoadResources {
+                path: path.to_string(),
+            });
+        }
+        Ok(self.finish_gltf_load(asset, source, scene, path, object_id, timings))
+    }
+
+    /// Parse the glTF and start loading its resources without blocking. The
+    /// asset is added to the scene by `pump_loads` once all resources are ready.
+    /// A path that is already loaded or loading is queued as a new instance.
+    pub fn begin_gltf_load(
+        &mut self,
+        engine: &mut Engine,
+        entity_manager: &mut EntityManager,
+        path: &str,
+        object_id: u64,
+    ) -> Result<(), AssetError> {
+        let source = source_key(path);
+        let source_known = self.instanced_sources.contains_key(&source)
+            || self.pending_loads.iter().any(|load| load.source == source);
+        if source_known {
+            self.queued_instances.push(QueuedInstance {
+                object_id,
+                path: path.to_string(),
+                source,
+                queued: Instant::now(),
+                frames: 0,
+            });
+            return Ok(());
+        }
+        let (mut resource_loader, mut asset, timings) =
+            self.create_gltf_asset(engine, entity_manager, path)?;
+        if !resource_loader.async_begin_load(&mut asset.asset) {
+            self.release_resource_loader(resource_loader);
+            return Err(AssetError::LoadResources {
+                path: path.to_string(),
+            });
+        }
+        self.pending_loads.push(PendingAssetLoad {
+            object_id,
+            path: path.to_string(),
+            source,
+            asset,
+            resource_loader,
+            timings,
+            started: Instant::now(),
+            frames: 0,
+            progress: 0.0,
+        });
+        Ok(())
+    }
+
+    /// Advance pending loads by one frame. Loads that finished are added to
+    /// `scene` and reported in submission order.
+    pub fn pump_loads(&mut self, scene: &mut Scene) -> Vec<CompletedAssetLoad> {
+        let mut completed = Vec::new();
+        let mut index = 0;
+        while index < self.pending_loads.len() {
+            let load = &mut self.pending_loads[index];
+            load.resource_loader.async_update_load();
+            load.frames = load.frames.saturating_add(1);
+            load.progress = load.resource_loader.async_load_progress().clamp(0.0, 1.0);
+            if load.progress < 1.0 {
+                index += 1;
+                continue;
+            }
+            let load = self.pending_loads.remove(index);
+            let stats = load.stats();
+            let PendingAssetLoad {
+                object_id,
+                path,
+                source,
+                asset,
+                resource_loader,
+                mut timings,
+                started,
+                ..
+            } = load;
+            timings.resources = started.elapsed();
+            self.release_resource_loader(resource_loader);
+            let asset = self.finish_gltf_load(asset, source, scene, &path, object_id, timings);
+            completed.push(CompletedAssetLoad {
+                object_id,
+                path,
+                asset,
+                stats,
+            });
+        }
+
+        let mut index = 0;
+        while index < self.queued_instances.len() {
+            let queued = &mut self.queued_instances[index];
+            queued.frames = queued.frames.saturating_add(1);
+            let source_index = self.instanced_sources.get(&queued.source).copied();
+            let source_loading = self
+                .pending_loads
+                .iter()
+                .any(|load| load.source == queued.source);
+            if source_index.is_none() && source_loading {
+                index += 1;
+                continue;
+            }
+            let queued = self.queued_instances.remove(index);
+            let loaded = source_index
+                .and_then(|index| self.instantiate(index, scene, &queued.path, queued.object_id));
+            let Some(asset) = loaded else {
+                log::warn!(
+                    "Dropped queued glTF instance '{}': source asset unavailable",
+                    queued.path
+                );
+                continue;
+            };
+            completed.push(CompletedAssetLoad {
+                object_id: queued.object_id,
+                path: queued.path,
+                asset,
+                stats: AssetLoadStats {
+                    frames: queued.frames,
+                    elapsed: queued.queued.elapsed(),
+                    progress: 1.0,
+                },
+            });
+        }
+        completed
+    }
+
+    /// Drop loads that have not finished yet; their objects never reach the scene.
+    pub fn cancel_pending_loads(&mut self) {
+        self.queued_instances.clear();
+        for mut load in self.pending_loads.drain(..) {
+            log::info!(
+                "Cancelled glTF load '{}' at {:.0}%",
+                load.path,
+                load.progress * 100.0
+            );
+            load.resource_loader.async_cancel_load();
+            self.retiring.assets.push(load.asset);
+            load.resource_loader.evict_resource_data();
+            self.idle_resource_loaders.push(load.resource_loader);
+        }
+    }
+
+    /// Take an idle resource loader, or create one, configured for `gltf_path`.
+    fn acquire_resource_loader(
+        &mut self,
+        engine: &mut Engine,
+        gltf_path: &str,
+    ) -> Result<GltfResourceLoader, AssetError> {
+        if let Some(mut loader) = self.idle_resource_loaders.pop() {
+            if loader.set_configuration(engine, Some(gltf_path), true) {
+                return Ok(loader);
+            }
+            self.idle_resource_loaders.push(loader);
+            return Err(AssetError::CreateResourceLoader);
         }
-        let material_provider = self
-            .material_provider
-            .as_mut()
-            .ok_or(AssetError::CreateMaterialProvider)?;
         let texture_provider = self
             .texture_provider
             .as_mut()
             .ok_or(AssetError::CreateTextureProvider)?;
+        let mut loader = GltfResourceLoader::create(engine, Some(gltf_path), true)
+            .ok_or(AssetError::CreateResourceLoader)?;
+        loader.add_texture_provider("image/png", texture_provider);
+        loader.add_texture_provider("image/jpeg", texture_provider);
+        if let Some(ktx2_provider) = self.ktx2_texture_provider.as_mut() {
+            loader.add_texture_provider("image/ktx2", ktx2_provider);
+        }
+        Ok(loader)
+    }
 
-        let mut asset_loader = GltfAssetLoader::create(engine, material_provider, entity_manager)
-            .ok_or(AssetError::CreateAssetLoader)?;
+    fn release_resource_loader(&mut self, mut loader: GltfResourceLoader) {
+        loader.evict_resource_data();
+        self.idle_resource_loaders.push(loader);
+    }
+
+    fn create_gltf_asset(
+        &mut self,
+        engine: &mut Engine,
+        entity_manager: &mut EntityManager,
+        path: &str,
+    ) -> Result<(GltfResourceLoader, StoredAsset, AssetLoadTimings), AssetError> {
+        let mut timings = AssetLoadTimings::default();
+        let (gltf_path, source) = match self.prepared_sources.remove(&resolve_gltf_path(path)) {
+            Some(prepared) => {
+                timings.read = prepared.read;
+                (prepared.gltf_path, prepared.source?)
+            }
+            None => {
+                let read_start = Instant::now();
+                let opened = open_gltf_source(path)?;
+                timings.read = read_start.elapsed();
+                opened
+            }
+        };
+
+        let setup_start = Instant::now();
+        if self.material_provider.is_none() {
+            self.material_provider = match self.material_provider_kind {
+                MaterialProviderKind::Jit => GltfMaterialProvider::create_jit(engine, false),
+                MaterialProviderKind::Ubershader => {
+                    GltfMaterialProvider::create_ubershader(engine, UBERSHADER_ARCHIVE)
+                }
+            };
+        }
+        if self.texture_provider.is_none() {
+            self.texture_provider =
+                GltfTextureProvider::create_parallel(engine, 0, TEXTURE_DECODE_MAX_RESIDENT);
+        }
+        if self.ktx2_texture_provider.is_none() {
+            self.ktx2_texture_provider = GltfTextureProvider::create_ktx2(engine);
+        }
+        if self.asset_loader.is_none() {
+            let material_provider = self
+                .material_provider
+                .as_mut()
+                .ok_or(AssetError::CreateMaterialProvider)?;
+            self.asset_loader = GltfAssetLoader::create(engine, material_provider, entity_manager);
+        }
         let gltf_path_string = gltf_path.to_string_lossy().to_string();
-        let mut resource_loader = GltfResourceLoader::create(engine, Some(&gltf_path_string), true)
-            .ok_or(AssetError::CreateResourceLoader)?;
-        resource_loader.add_texture_provider("image/png", texture_provider);
-        resource_loader.add_texture_provider("image/jpeg", texture_provider);
+        let mut resource_loader = self.acquire_resource_loader(engine, &gltf_path_string)?;
+        for buffer in source.buffers() {
+            resource_loader.add_shared_resource_data(
+                &buffer.uri,
+                Arc::clone(&buffer.mapping),
+                buffer.range.clone(),
+            );
+        }
+        for buffer in source.decoded_buffers() {
+            let len = buffer.data.len();
+            resource_loader.add_shared_resource_data(&buffer.uri, Arc::clone(&buffer.data), 0..len);
+        }
+        timings.loader_setup = setup_start.elapsed();
 
-        let mut asset = asset_loader
-            .create_asset_from_json(&gltf_bytes)
-            .ok_or_else(|| AssetError::ParseGltf {
-                path: path.to_string(),
-            })?;
-        let loaded = resource_loader.load_resources(&mut asset);
-        if !loaded {
-            return Err(AssetError::LoadResources {
+        let parse_start = Instant::now();
+        let asset = match self.asset_loader.as_mut() {
+            Some(asset_loader) => asset_loader.create_instanced_asset_from_json(source.json()),
+            None => {
+                self.release_resource_loader(resource_loader);
+                return Err(AssetError::CreateAssetLoader);
+            }
+        };
+        let Some(asset) = asset else {
+            self.release_resource_loader(resource_loader);
+            return Err(AssetError::ParseGltf {
                 path: path.to_string(),
             });
+        };
+        timings.parse = parse_start.elapsed();
+        log::debug!(
+            "Mapped '{}': {} bytes, {} buffers served in place",
+            gltf_path.display(),
+            source.mapped_bytes(),
+            source.buffers().len()
+        );
+        let compression = source.compression();
+        if compression.meshopt_views > 0 {
+            log::info!(
+                "Decoded {} meshopt buffer views of '{}' on {} workers: {} -> {} bytes in {:.2} ms",
+                compression.meshopt_views,
+                gltf_path.display(),
+                compression.meshopt_workers,
+                compression.meshopt_encoded_bytes,
+                compression.meshopt_decoded_bytes,
+                compression.meshopt_decode.as_secs_f64() * 1000.0
+            );
+        }
+        if compression.draco || compression.quantized {
+            // gltfio decodes Draco and uploads quantized attributes as stored.
+            log::debug!(
+                "'{}' compressed geometry: draco={} quantized={}",
+                gltf_path.display(),
+                compression.draco,
+                compression.quantized
+            );
         }
-        asset.release_source_data();
-        asset.add_entities_to_scene(scene);
+        let asset = StoredAsset {
+            asset,
+            _mappings: source.buffer_mappings(),
+            _decoded_buffers: source
+                .decoded_buffers()
+                .iter()
+                .map(|buffer| Arc::clone(&buffer.data))
+                .collect(),
+        };
+        Ok((resource_loader, asset, timings))
+    }
+
+    fn finish_gltf_load(
+        &mut self,
+        asset: StoredAsset,
+        source: PathBuf,
+        scene: &mut Scene,
+        path: &str,
+        object_id: u64,
+        timings: AssetLoadTimings,
+    ) -> LoadedAsset {
+        // Keep asset alive by storing it (prevents Drop from destroying entities).
+        // Its source data is kept: gltfio needs it to add instances later.
+        let index = self.gltf_assets.len();
+        let instance = asset.asset.instance();
+        self.gltf_assets.push(Some(asset));
+        self.instanced_sources.insert(source, index);
+        self.finish_instance(index, instance, scene, path, object_id, false, timings)
+    }
 
+    /// Add a new instance of an already-loaded asset. Returns `None` if gltfio
+    /// could not create one, in which case the caller loads the path afresh.
+    fn instantiate(
+        &mut self,
+        index: usize,
+        scene: &mut Scene,
+        path: &str,
+        object_id: u64,
+    ) -> Option<LoadedAsset> {
+        let start = Instant::now();
+        let instance = self
+            .gltf_assets
+            .get_mut(index)?
+            .as_mut()?
+            .asset
+            .create_instance()?;
+        let timings = AssetLoadTimings {
+            finalize: start.elapsed(),
+            ..AssetLoadTimings::default()
+        };
+        Some(self.finish_instance(index, Some(instance), scene, path, object_id, true, timings))
+    }
+
+    fn finish_instance(
+        &mut self,
+        index: usize,
+        instance: Option<GltfInstance>,
+        scene: &mut Scene,
+        path: &str,
+        object_id: u64,
+        instanced: bool,
+        mut timings: AssetLoadTimings,
+    ) -> LoadedAsset {
+        let finalize_start = Instant::now();
+        let asset = &mut self.gltf_assets[index]
+            .as_mut()
+            .expect("instances are only created for live assets")
+            .asset;
         let (center, extent) = asset.bounding_box();
-        let root_entity = asset.root_entity();
-        let renderable_entities = asset.renderable_entities();
+        let (root_entity, renderable_entities, (instances, names)) = match &instance {
+            Some(instance) => {
+                instance.add_entities_to_scene(scene);
+                (
+                    instance.root_entity(),
+                    instance.renderable_entities(),
+                    instance.material_instances(),
+                )
+            }
+            None => {
+                asset.add_entities_to_scene(scene);
+                (
+                    asset.root_entity(),
+                    asset.renderable_entities(),
+                    asset.material_instances(),
+                )
+            }
+        };
         let name = PathBuf::from(path)
             .file_name()
             .and_then(|value| value.to_str())
             .unwrap_or("gltf")
             .to_string();
-        let loaded_asset = LoadedAsset {
-            name,
-            center,
-            extent,
-            root_entity,
-            renderable_entities,
-        };
-
-        // Keep asset alive by storing it (prevents Drop from destroying entities)
-        let (instances, names) = asset.material_instances();
         let bindings: Vec<MaterialBinding> = names
             .iter()
             .enumerate()
@@ -171,35 +945,74 @@ impl AssetManager {
                 object_id,
             })
             .collect();
+        timings.finalize += finalize_start.elapsed();
+        let loaded_asset = LoadedAsset {
+            name,
+            center,
+            extent,
+            root_entity,
+            renderable_entities,
+            instanced,
+            timings,
+        };
+
+        let first_material = self.material_instances.len();
+        for (offset, binding) in bindings.iter().enumerate() {
+            self.material_slots.insert(
+                (binding.object_id, binding.material_slot),
+                first_material + offset,
+            );
+        }
+        self.loaded_by_root
+            .insert(loaded_asset.root_entity, self.loaded_assets.len());
         self.material_instances.extend(instances);
         self.material_bindings.extend(bindings);
-        self.gltf_assets.push(asset);
         self.loaded_assets.push(loaded_asset.clone());
-        Ok(loaded_asset)
+        self.objects.push(AssetObject {
+            object_id,
+            asset_index: index,
+            instance,
+            path: path.to_string(),
+        });
+        loaded_asset
     }
 }
 
 impl Drop for AssetManager {
     fn drop(&mut self) {
         // Ensure material instances are dropped before assets/providers.
+        self.cancel_pending_loads();
         self.material_instances.clear();
-        self.retired_material_instances.clear();
         self.material_bindings.clear();
+        self.loaded_by_root.clear();
+        self.material_slots.clear();
+        self.retiring = RetiredResources::default();
+        self.retired_batches.clear();
+        self.objects.clear();
         self.gltf_assets.clear();
-        self.retired_gltf_assets.clear();
         self.loaded_assets.clear();
+        self.idle_resource_loaders.clear();
+        self.prepared_sources.clear();
+        self.asset_loader = None;
         self.texture_provider = None;
+        self.ktx2_texture_provider = None;
         self.material_provider = None;
     }
 }
 
-fn load_gltf_bytes(path: &str) -> Result<(PathBuf, Vec<u8>), AssetError> {
+fn open_gltf_source(path: &str) -> Result<(PathBuf, GltfSource), AssetError> {
     let gltf_path = resolve_gltf_path(path);
-    let bytes = std::fs::read(&gltf_path).map_err(|source| AssetError::Read {
+    let source = GltfSource::open(&gltf_path).map_err(|source| AssetError::Read {
         path: gltf_path.display().to_string(),
         source,
     })?;
-    Ok((gltf_path, bytes))
+    Ok((gltf_path, source))
+}
+
+/// Key used to recognise repeated loads of the same file.
+fn source_key(path: &str) -> PathBuf {
+    let resolved = resolve_gltf_path(path);
+    std::fs::canonicalize(&resolved).unwrap_or(resolved)
 }
 
 fn resolve_gltf_path(path: &str) -> PathBuf {
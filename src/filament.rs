@@ -6,7 +6,9 @@
 
 use crate::ffi;
 use std::ffi::{c_char, c_void, CString};
+use std::ops::Range;
 use std::ptr::NonNull;
+use std::sync::{Arc, Mutex};
 
 /// Backend rendering API
 #[repr(u8)]
@@ -94,7 +96,7 @@ pub enum LightType {
     FocusedSpot = 4,
 }
 
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone, Copy, PartialEq)]
 pub struct LightShadowOptions {
     pub cast_shadows: bool,
     pub map_size: u32,
@@ -104,7 +106,7 @@ pub struct LightShadowOptions {
     pub far_hint: f32,
 }
 
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone, Copy, PartialEq)]
 pub struct LightParams {
     pub light_type: LightType,
     pub color: [f32; 3],
@@ -120,6 +122,100 @@ pub struct LightParams {
     pub shadow: LightShadowOptions,
 }
 
+impl LightParams {
+    /// Fields that differ from `previous`, as a mask for `Engine::update_lights`.
+    pub fn dirty_mask(&self, previous: &LightParams) -> LightDirtyMask {
+        let mut bits = 0;
+        if self.color != previous.color {
+            bits |= ffi::LIGHT_DIRTY_COLOR;
+        }
+        if self.intensity != previous.intensity {
+            bits |= ffi::LIGHT_DIRTY_INTENSITY;
+        }
+        if self.position != previous.position {
+            bits |= ffi::LIGHT_DIRTY_POSITION;
+        }
+        if self.direction != previous.direction {
+            bits |= ffi::LIGHT_DIRTY_DIRECTION;
+        }
+        if self.range != previous.range {
+            bits |= ffi::LIGHT_DIRTY_FALLOFF;
+        }
+        if self.spot_inner_deg != previous.spot_inner_deg
+            || self.spot_outer_deg != previous.spot_outer_deg
+        {
+            bits |= ffi::LIGHT_DIRTY_SPOT_CONE;
+        }
+        if self.sun_angular_radius_deg != previous.sun_angular_radius_deg
+            || self.sun_halo_size != previous.sun_halo_size
+            || self.sun_halo_falloff != previous.sun_halo_falloff
+        {
+            bits |= ffi::LIGHT_DIRTY_SUN;
+        }
+        if self.shadow.cast_shadows != previous.shadow.cast_shadows {
+            bits |= ffi::LIGHT_DIRTY_SHADOW_CASTER;
+        }
+        let shadow_options_changed = LightShadowOptions {
+            cast_shadows: previous.shadow.cast_shadows,
+            ..self.shadow
+        } != previous.shadow;
+        if shadow_options_changed {
+            bits |= ffi::LIGHT_DIRTY_SHADOW_OPTIONS;
+        }
+        LightDirtyMask(bits)
+    }
+
+    fn to_ffi(&self) -> ffi::LightParamsC {
+        ffi::LightParamsC {
+            light_type: self.light_type as u8,
+            color: self.color,
+            intensity: self.intensity,
+            position: self.position,
+            direction: self.direction,
+            range: self.range,
+            spot_inner_deg: self.spot_inner_deg,
+            spot_outer_deg: self.spot_outer_deg,
+            sun_angular_radius_deg: self.sun_angular_radius_deg,
+            sun_halo_size: self.sun_halo_size,
+            sun_halo_falloff: self.sun_halo_falloff,
+            cast_shadows: self.shadow.cast_shadows,
+            shadow_map_size: self.shadow.map_size,
+            shadow_cascades: self.shadow.cascades,
+            shadow_far: self.shadow.shadow_far,
+            shadow_near_hint: self.shadow.near_hint,
+            shadow_far_hint: self.shadow.far_hint,
+        }
+    }
+}
+
+/// Light fields to apply in `Engine::update_lights`. Shadow options are only
+/// reset when their bit is set, since that can reallocate shadow maps.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct LightDirtyMask(pub u32);
+
+impl LightDirtyMask {
+    pub const NONE: Self = Self(0);
+    pub const ALL: Self = Self(
+        ffi::LIGHT_DIRTY_COLOR
+            | ffi::LIGHT_DIRTY_INTENSITY
+            | ffi::LIGHT_DIRTY_POSITION
+            | ffi::LIGHT_DIRTY_DIRECTION
+            | ffi::LIGHT_DIRTY_FALLOFF
+            | ffi::LIGHT_DIRTY_SPOT_CONE
+            | ffi::LIGHT_DIRTY_SUN
+            | ffi::LIGHT_DIRTY_SHADOW_CASTER
+            | ffi::LIGHT_DIRTY_SHADOW_OPTIONS,
+    );
+
+    pub fn is_empty(self) -> bool {
+        self.0 == 0
+    }
+
+    pub fn contains(self, bits: u32) -> bool {
+        self.0 & bits == bits
+    }
+}
+
 /// Index buffer type enum
 /// Values must match backend::ElementType
 #[repr(u8)]
@@ -129,6 +225,51 @@ pub enum IndexType {
     UInt = 17,   // ElementType::UINT
 }
 
+/// Engine::Config sizing applied at engine creation. Zero fields keep Filament's
+/// defaults; Filament clamps the rest to valid minimums.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, serde::Serialize, serde::Deserialize)]
+#[serde(default)]
+pub struct EngineConfig {
+    pub command_buffer_size_mb: u32,
+    pub per_render_pass_arena_size_mb: u32,
+    pub driver_handle_arena_size_mb: u32,
+    pub min_command_buffer_size_mb: u32,
+    pub per_frame_commands_size_mb: u32,
+    /// JobSystem worker threads; 0 lets Filament pick from the core count.
+    pub job_system_thread_count: u32,
+    pub resource_allocator_cache_size_mb: u32,
+    /// Frames an unused render target stays cached.
+    pub resource_allocator_cache_max_age: u32,
+}
+
+impl EngineConfig {
+    fn to_ffi(self) -> ffi::EngineConfigC {
+        ffi::EngineConfigC {
+            command_buffer_size_mb: self.command_buffer_size_mb,
+            per_render_pass_arena_size_mb: self.per_render_pass_arena_size_mb,
+            driver_handle_arena_size_mb: self.driver_handle_arena_size_mb,
+            min_command_buffer_size_mb: self.min_command_buffer_size_mb,
+            per_frame_commands_size_mb: self.per_frame_commands_size_mb,
+            job_system_thread_count: self.job_system_thread_count,
+            resource_allocator_cache_size_mb: self.resource_allocator_cache_size_mb,
+            resource_allocator_cache_max_age: self.resource_allocator_cache_max_age,
+        }
+    }
+
+    fn from_ffi(config: ffi::EngineConfigC) -> Self {
+        Self {
+            command_buffer_size_mb: config.command_buffer_size_mb,
+            per_render_pass_arena_size_mb: config.per_render_pass_arena_size_mb,
+            driver_handle_arena_size_mb: config.driver_handle_arena_size_mb,
+            min_command_buffer_size_mb: config.min_command_buffer_size_mb,
+            per_frame_commands_size_mb: config.per_frame_commands_size_mb,
+            job_system_thread_count: config.job_system_thread_count,
+            resource_allocator_cache_size_mb: config.resource_allocator_cache_size_mb,
+            resource_allocator_cache_max_age: config.resource_allocator_cache_max_age,
+        }
+    }
+}
+
 /// Filament Engine - the main entry point for all Filament operations
 pub struct Engine {
     ptr: NonNull<c_void>,
@@ -143,6 +284,44 @@ impl Engine {
         }
     }
 
+    /// Create a new Filament engine with explicit Engine::Config sizing
+    pub fn create_with_config(backend: Backend, config: &EngineConfig) -> Option<Self> {
+        let config = config.to_ffi();
+        unsafe {
+            let ptr = ffi::filament_engine_create_with_config(backend as u8, &config);
+            NonNull::new(ptr as *mut c_void).map(|ptr| Engine { ptr })
+        }
+    }
+
+    /// Configuration the engine is running with, after Filament's validation.
+    pub fn config(&self) -> EngineConfig {
+        let mut config = ffi::EngineConfigC::default();
+        unsafe {
+            ffi::filament_engine_get_config(self.ptr.as_ptr() as *const _, &mut config);
+        }
+        EngineConfig::from_ffi(config)
+    }
+
+    /// Persist compiled backend programs under `directory` (which must exist)
+    /// and reuse them on later runs. Must be called before any material is built.
+    pub fn enable_program_cache(&mut self, directory: &std::path::Path) -> bool {
+        let Ok(c_dir) = CString::new(directory.to_string_lossy().as_ref()) else {
+            log::warn!("Invalid program cache path (contains NUL byte).");
+            return false;
+        };
+        unsafe {
+            ffi::filament_engine_enable_program_cache(self.ptr.as_ptr() as *mut _, c_dir.as_ptr())
+        }
+    }
+
+    pub fn program_cache_stats(&self) -> ProgramCacheStats {
+        let mut stats = ProgramCacheStats::default();
+        unsafe {
+            ffi::filament_program_cache_get_stats(&mut stats);
+        }
+        stats
+    }
+
     /// Create a swap chain for a native window
     pub fn create_swap_chain(&mut self, native_window: *mut c_void) -> Option<SwapChain> {
         unsafe {
@@ -224,33 +403,12 @@ impl Engine {
         entity_manager: &mut EntityManager,
         params: LightParams,
     ) -> Entity {
+        let params = params.to_ffi();
         unsafe {
             let id = ffi::filament_light_create(
                 self.ptr.as_ptr() as *mut _,
                 entity_manager.ptr.as_ptr() as *mut _,
-                params.light_type as u8,
-                params.color[0],
-                params.color[1],
-                params.color[2],
-                params.intensity,
-                params.position[0],
-                params.position[1],
-                params.position[2],
-                params.direction[0],
-                params.direction[1],
-                params.direction[2],
-                params.range,
-                params.spot_inner_deg,
-                params.spot_outer_deg,
-                params.sun_angular_radius_deg,
-                params.sun_halo_size,
-                params.sun_halo_falloff,
-                params.shadow.cast_shadows,
-                params.shadow.map_size,
-                params.shadow.cascades,
-                params.shadow.shadow_far,
-                params.shadow.near_hint,
-                params.shadow.far_hint,
+                &params,
             );
             Entity { id }
         }
@@ -263,34 +421,35 @@ impl Engine {
         }
     }
 
-    /// Update light parameters for an existing light entity.
+    /// Update light parameters for an existing light entity, resetting every field.
     pub fn set_light(&mut self, entity: Entity, params: LightParams) {
+        self.update_lights(&[(entity, params, LightDirtyMask::ALL)]);
+    }
+
+    /// Apply a batch of light updates in one call, touching only the fields in
+    /// each entry's dirty mask. Entries with an empty mask are skipped.
+    pub fn update_lights(&mut self, updates: &[(Entity, LightParams, LightDirtyMask)]) {
+        let mut entity_ids = Vec::with_capacity(updates.len());
+        let mut params = Vec::with_capacity(updates.len());
+        let mut masks = Vec::with_capacity(updates.len());
+        for (entity, light, mask) in updates {
+            if mask.is_empty() {
+                continue;
+            }
+            entity_ids.push(entity.id);
+            params.push(light.to_ffi());
+            masks.push(mask.0);
+        }
+        if entity_ids.is_empty() {
+            return;
+        }
         unsafe {
-            ffi::filament_light_set(
+            ffi::filament_lights_update(
                 self.ptr.as_ptr() as *mut _,
-                entity.id,
-                params.color[0],
-                params.color[1],
-                params.color[2],
-                params.intensity,
-                params.position[0],
-                params.position[1],
-                params.position[2],
-                params.direction[0],
-                params.direction[1],
-                params.direction[2],
-                params.range,
-                params.spot_inner_deg,
-                params.spot_outer_deg,
-                params.sun_angular_radius_deg,
-                params.sun_halo_size,
-                params.sun_halo_falloff,
-                params.shadow.cast_shadows,
-                params.shadow.map_size,
-                params.shadow.cascades,
-                params.shadow.shadow_far,
-                params.shadow.near_hint,
-                params.shadow.far_hint,
+                entity_ids.as_ptr(),
+                params.as_ptr(),
+                masks.as_ptr(),
+                entity_ids.len(),
             );
         }
     }
@@ -402,6 +561,101 @@ impl Engine {
         }
     }
 
+    /// Like `bind_material_texture_from_ktx`, for a KTX1/KTX2 file already
+    /// read into memory. The bytes are copied.
+    pub fn bind_material_texture_from_ktx_bytes(
+        &mut self,
+        material_instance: &mut MaterialInstance,
+        param_name: &str,
+        ktx_bytes: &[u8],
+        wrap_repeat_u: bool,
+        wrap_repeat_v: bool,
+    ) -> Option<Texture> {
+        let c_param = match CString::new(param_name) {
+            Ok(name) => name,
+            Err(_) => {
+                log::warn!("Invalid texture parameter name (contains NUL byte).");
+                return None;
+            }
+        };
+        unsafe {
+            let mut texture_ptr: *mut ffi::Texture = std::ptr::null_mut();
+            let ok = ffi::filament_material_instance_set_texture_from_ktx_bytes(
+                self.ptr.as_ptr() as *mut _,
+                material_instance.ptr.as_ptr() as *mut _,
+                c_param.as_ptr(),
+                ktx_bytes.as_ptr(),
+                ktx_bytes.len(),
+                wrap_repeat_u,
+                wrap_repeat_v,
+                &mut texture_ptr as *mut *mut ffi::Texture,
+            );
+            if !ok {
+                return None;
+            }
+            NonNull::new(texture_ptr as *mut c_void).map(|ptr| Texture {
+                ptr,
+                engine: self.ptr,
+                owned: false,
+            })
+        }
+    }
+
+    /// Start transcoding a Basis KTX2 file off the engine thread: creates the
+    /// texture here, then `Ktx2Transcode::transcode` may run on any thread.
+    /// Returns `None` for KTX1 and anything that is not a valid KTX2 file.
+    pub fn begin_ktx2_transcode(&mut self, ktx2_bytes: &[u8]) -> Option<Ktx2Transcode> {
+        let ptr = unsafe {
+            ffi::filament_ktx2_transcode_create(
+                self.ptr.as_ptr() as *mut _,
+                ktx2_bytes.as_ptr(),
+                ktx2_bytes.len(),
+            )
+        };
+        NonNull::new(ptr as *mut c_void).map(|ptr| Ktx2Transcode {
+            ptr,
+            engine: self.ptr,
+        })
+    }
+
+    /// Like `bind_material_texture_from_ktx_bytes`, for a finished transcode.
+    /// The texture is uploaded on first use and shared by later bindings.
+    pub fn bind_material_texture_from_ktx2_transcode(
+        &mut self,
+        material_instance: &mut MaterialInstance,
+        param_name: &str,
+        transcode: &mut Ktx2Transcode,
+        wrap_repeat_u: bool,
+        wrap_repeat_v: bool,
+    ) -> Option<Texture> {
+        let c_param = match CString::new(param_name) {
+            Ok(name) => name,
+            Err(_) => {
+                log::warn!("Invalid texture parameter name (contains NUL byte).");
+                return None;
+            }
+        };
+        unsafe {
+            let mut texture_ptr: *mut ffi::Texture = std::ptr::null_mut();
+            let ok = ffi::filament_material_instance_set_texture_from_ktx2_transcode(
+                material_instance.ptr.as_ptr() as *mut _,
+                c_param.as_ptr(),
+                transcode.ptr.as_ptr() as *mut _,
+                wrap_repeat_u,
+                wrap_repeat_v,
+                &mut texture_ptr as *mut *mut ffi::Texture,
+            );
+            if !ok {
+                return None;
+            }
+            NonNull::new(texture_ptr as *mut c_void).map(|ptr| Texture {
+                ptr,
+                engine: self.ptr,
+                owned: false,
+            })
+        }
+    }
+
     pub fn set_texture_image_rgba8(
         &mut self,
         texture: &mut Texture,
@@ -421,6 +675,50 @@ impl Engine {
         }
     }
 
+    /// Create a staging ring of `frame_count` slots with `bytes_per_frame` of
+    /// preallocated upload memory each.
+    pub fn create_staging_ring(
+        &mut self,
+        frame_count: u32,
+        bytes_per_frame: usize,
+    ) -> Option<StagingRing> {
+        unsafe {
+            let ptr = ffi::filament_staging_ring_create(
+                self.ptr.as_ptr() as *mut _,
+                frame_count,
+                bytes_per_frame,
+            );
+            NonNull::new(ptr as *mut c_void).map(|ptr| StagingRing { ptr })
+        }
+    }
+
+    /// Zero-copy variant of `set_texture_image_rgba8`: Filament reads `pixels`
+    /// in place and returns the buffer to `pool` when the upload completes.
+    pub fn set_texture_image_rgba8_pooled(
+        &mut self,
+        texture: &mut Texture,
+        width: u32,
+        height: u32,
+        pool: &UploadPool<u8>,
+        pixels: Vec<u8>,
+    ) -> bool {
+        let Some((ptr, size, user)) = pool.submit(pixels) else {
+            return false;
+        };
+        unsafe {
+            ffi::filament_texture_set_image_rgba8_owned(
+                self.ptr.as_ptr() as *mut _,
+                texture.ptr.as_ptr() as *mut _,
+                width,
+                height,
+                ptr,
+                size,
+                Some(release_pooled_upload::<u8>),
+                user,
+            )
+        }
+    }
+
     /// Create a material from package bytes
     pub fn create_material(&mut self, package: &[u8]) -> Option<Material> {
         unsafe {
@@ -480,6 +778,32 @@ impl Engine {
         }
     }
 
+    /// Submit queued commands to the backend without waiting on them.
+    pub fn flush(&mut self) {
+        unsafe {
+            ffi::filament_engine_flush(self.ptr.as_ptr() as *mut _);
+        }
+    }
+
+    /// Dispatch pending Filament callbacks (buffer releases, readback
+    /// completions) without blocking on the GPU.
+    pub fn pump_message_queues(&mut self) {
+        unsafe {
+            ffi::filament_engine_pump_message_queues(self.ptr.as_ptr() as *mut _);
+        }
+    }
+
+    /// Insert a fence after every command issued so far.
+    pub fn create_fence(&mut self) -> Option<Fence> {
+        unsafe {
+            let ptr = ffi::filament_engine_create_fence(self.ptr.as_ptr() as *mut _);
+            NonNull::new(ptr as *mut c_void).map(|ptr| Fence {
+                ptr,
+                engine: self.ptr,
+            })
+        }
+    }
+
     /// Get raw pointer (for advanced use)
     pub fn as_ptr(&self) -> *mut c_void {
         self.ptr.as_ptr()
@@ -495,6 +819,41 @@ impl Drop for Engine {
     }
 }
 
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum FenceStatus {
+    Signaled,
+    Pending,
+    Error,
+}
+
+/// GPU fence; signals once the commands issued before it have completed.
+pub struct Fence {
+    ptr: NonNull<c_void>,
+    engine: NonNull<c_void>,
+}
+
+impl Fence {
+    /// Check the fence without blocking or flushing.
+    pub fn poll(&self) -> FenceStatus {
+        match unsafe { ffi::filament_fence_poll(self.ptr.as_ptr() as *mut _) } {
+            0 => FenceStatus::Signaled,
+            1 => FenceStatus::Pending,
+            _ => FenceStatus::Error,
+        }
+    }
+}
+
+impl Drop for Fence {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::filament_engine_destroy_fence(
+                self.engine.as_ptr() as *mut _,
+                self.ptr.as_ptr() as *mut _,
+            );
+        }
+    }
+}
+
 /// Swap chain for presenting to a window
 pub struct SwapChain {
     ptr: NonNull<c_void>,
@@ -658,6 +1017,34 @@ impl Drop for Texture {
     }
 }
 
+/// Basis KTX2 texture being transcoded; see `Engine::begin_ktx2_transcode`.
+/// Must be dropped on the engine thread.
+pub struct Ktx2Transcode {
+    ptr: NonNull<c_void>,
+    engine: NonNull<c_void>,
+}
+
+// Transcoding only touches the handle's own reader and image data.
+unsafe impl Send for Ktx2Transcode {}
+
+impl Ktx2Transcode {
+    /// Transcode every level; safe to call from any thread.
+    pub fn transcode(&mut self) -> bool {
+        unsafe { ffi::filament_ktx2_transcode_run(self.ptr.as_ptr() as *mut _) }
+    }
+}
+
+impl Drop for Ktx2Transcode {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::filament_ktx2_transcode_destroy(
+                self.engine.as_ptr() as *mut _,
+                self.ptr.as_ptr() as *mut _,
+            );
+        }
+    }
+}
+
 /// Indirect light
 pub struct IndirectLight {
     ptr: NonNull<c_void>,
@@ -737,6 +1124,19 @@ impl View {
         }
     }
 
+    /// Issue a `View::pick` query at window coordinates (bottom-left origin).
+    /// The result arrives after this view is next rendered; poll `query`.
+    pub fn pick(&self, window_x: u32, window_y: u32, query: &mut ViewPickQuery) -> bool {
+        unsafe {
+            ffi::filament_view_pick(
+                self.ptr.as_ptr() as *mut _,
+                window_x,
+                window_y,
+                query.ptr.as_ptr() as *mut _,
+            )
+        }
+    }
+
     /// Enable or disable post-processing
     pub fn set_post_processing_enabled(&mut self, enabled: bool) {
         unsafe {
@@ -828,6 +1228,18 @@ impl Camera {
             );
         }
     }
+
+    /// Column-major projection * view matrix.
+    pub fn view_projection_matrix(&self) -> [f64; 16] {
+        let mut matrix = [0.0f64; 16];
+        unsafe {
+            ffi::filament_camera_get_view_projection(
+                self.ptr.as_ptr() as *mut _,
+                matrix.as_mut_ptr(),
+            );
+        }
+        matrix
+    }
 }
 
 impl Drop for Camera {
@@ -843,7 +1255,7 @@ impl Drop for Camera {
 
 /// Entity identifier
 /// Entity identifier
-#[derive(Debug, Clone, Copy, PartialEq, Eq, serde::Serialize, serde::Deserialize)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, serde::Serialize, serde::Deserialize)]
 pub struct Entity {
     pub id: i32,
 }
@@ -885,6 +1297,27 @@ impl TransformManager {
             );
         }
     }
+
+    /// Set many local transforms with one FFI call and one hierarchy update.
+    pub fn set_transforms(&mut self, transforms: &[(Entity, [f32; 16])]) {
+        if transforms.is_empty() {
+            return;
+        }
+        let mut entity_ids = Vec::with_capacity(transforms.len());
+        let mut matrices = Vec::with_capacity(transforms.len() * 16);
+        for (entity, matrix4x4) in transforms {
+            entity_ids.push(entity.id);
+            matrices.extend_from_slice(matrix4x4);
+        }
+        unsafe {
+            ffi::filament_transform_manager_set_transforms(
+                self.ptr.as_ptr() as *mut _,
+                entity_ids.as_ptr(),
+                matrices.as_ptr(),
+                entity_ids.len(),
+            );
+        }
+    }
 }
 
 /// Material
@@ -917,6 +1350,92 @@ impl Material {
             })
         }
     }
+
+    /// Start building the backend programs for `variants` so the first draw
+    /// does not compile them. Returns immediately.
+    pub fn compile(&self, variants: MaterialVariantMask, high_priority: bool) {
+        unsafe {
+            ffi::filament_material_compile(self.ptr.as_ptr() as *mut _, variants.0, high_priority);
+        }
+    }
+}
+
+/// User variants to include in `Material::compile` (mirrors Filament's
+/// `UserVariantFilterBit`). Variants needing a feature outside the mask are
+/// skipped.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct MaterialVariantMask(pub u32);
+
+impl MaterialVariantMask {
+    /// Unlit, unshadowed programs only.
+    pub const BASE: Self = Self(0);
+    pub const LIT: Self =
+        Self(ffi::VARIANT_FILTER_DIRECTIONAL_LIGHTING | ffi::VARIANT_FILTER_DYNAMIC_LIGHTING);
+    pub const SHADOWED: Self = Self(ffi::VARIANT_FILTER_SHADOW_RECEIVER);
+
+    pub fn union(self, other: Self) -> Self {
+        Self(self.0 | other.0)
+    }
+}
+
+/// A batch of background `Material::compile` requests. Each material is
+/// queued once; completion is observed after the engine pumps its message
+/// queues. Dropping it mid-flight is safe.
+pub struct MaterialWarmup {
+    ptr: NonNull<c_void>,
+}
+
+impl MaterialWarmup {
+    pub fn new() -> Option<Self> {
+        unsafe {
+            let ptr = ffi::filament_material_warmup_create();
+            NonNull::new(ptr as *mut c_void).map(|ptr| Self { ptr })
+        }
+    }
+
+    /// Queue `material`. Returns false if it is already part of this batch.
+    pub fn add(&mut self, material: &Material, variants: MaterialVariantMask) -> bool {
+        unsafe {
+            ffi::filament_material_warmup_add(
+                self.ptr.as_ptr() as *mut _,
+                material.ptr.as_ptr() as *mut _,
+                variants.0,
+            )
+        }
+    }
+
+    /// Queue the material `instance` was created from.
+    pub fn add_instance(
+        &mut self,
+        instance: &MaterialInstance,
+        variants: MaterialVariantMask,
+    ) -> bool {
+        unsafe {
+            ffi::filament_material_warmup_add_instance(
+                self.ptr.as_ptr() as *mut _,
+                instance.ptr.as_ptr() as *mut _,
+                variants.0,
+            )
+        }
+    }
+
+    /// Number of distinct materials queued.
+    pub fn count(&self) -> u32 {
+        unsafe { ffi::filament_material_warmup_get_count(self.ptr.as_ptr() as *const _) }
+    }
+
+    /// Number of queued materials whose programs are still compiling.
+    pub fn pending(&self) -> u32 {
+        unsafe { ffi::filament_material_warmup_get_pending(self.ptr.as_ptr() as *const _) }
+    }
+}
+
+impl Drop for MaterialWarmup {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::filament_material_warmup_destroy(self.ptr.as_ptr() as *mut _);
+        }
+    }
 }
 
 /// Material instance
@@ -1140,6 +1659,19 @@ impl GltfMaterialProvider {
             NonNull::new(ptr as *mut c_void).map(|ptr| GltfMaterialProvider { ptr })
         }
     }
+
+    /// Ubershader provider backed by a precompiled `.uberz` archive; no shaders
+    /// are generated at load time. An empty `archive` uses gltfio's default.
+    pub fn create_ubershader(engine: &mut Engine, archive: &'static [u8]) -> Option<Self> {
+        unsafe {
+            let ptr = ffi::filament_gltfio_create_ubershader_provider(
+                engine.ptr.as_ptr() as *mut _,
+                archive.as_ptr(),
+                archive.len() as u32,
+            );
+            NonNull::new(ptr as *mut c_void).map(|ptr| GltfMaterialProvider { ptr })
+        }
+    }
 }
 
 impl Drop for GltfMaterialProvider {
@@ -1151,9 +1683,13 @@ impl Drop for GltfMaterialProvider {
     }
 }
 
-/// gltfio texture provider (stb image)
+pub type TextureDecodeStats = ffi::TextureDecodeStatsC;
+
+/// gltfio texture provider: stb decode on the loading thread, KTX2 transcode,
+/// or stb decode on a worker pool (`create_parallel`)
 pub struct GltfTextureProvider {
     ptr: NonNull<c_void>,
+    parallel: bool,
 }
 
 impl GltfTextureProvider {
@@ -1161,9 +1697,118 @@ impl GltfTextureProvider {
         unsafe {
             let ptr =
                 ffi::filament_gltfio_create_stb_texture_provider(engine.ptr.as_ptr() as *mut _);
-            NonNull::new(ptr as *mut c_void).map(|ptr| GltfTextureProvider { ptr })
+            NonNull::new(ptr as *mut c_void).map(|ptr| GltfTextureProvider {
+                ptr,
+                parallel: false,
+            })
+        }
+    }
+
+    /// KTX2 provider for `KHR_texture_basisu` images; transcodes Basis data
+    /// to a block-compressed format the backend supports.
+    pub fn create_ktx2(engine: &mut Engine) -> Option<Self> {
+        unsafe {
+            let ptr =
+                ffi::filament_gltfio_create_ktx2_texture_provider(engine.ptr.as_ptr() as *mut _);
+            NonNull::new(ptr as *mut c_void).map(|ptr| GltfTextureProvider {
+                ptr,
+                parallel: false,
+            })
         }
     }
+
+    /// PNG/JPEG provider that decodes on `worker_count` threads and holds at
+    /// most `max_resident` decoded images awaiting upload. Zero picks a
+    /// default for either.
+    pub fn create_parallel(
+        engine: &mut Engine,
+        worker_count: u32,
+        max_resident: u32,
+    ) -> Option<Self> {
+        unsafe {
+            let ptr = ffi::filament_gltfio_create_parallel_texture_provider(
+                engine.ptr.as_ptr() as *mut _,
+                worker_count,
+                max_resident,
+            );
+            NonNull::new(ptr as *mut c_void).map(|ptr| GltfTextureProvider {
+                ptr,
+                parallel: true,
+            })
+        }
+    }
+
+    /// Decode counters; only the parallel provider keeps them.
+    pub fn decode_stats(&self) -> Option<TextureDecodeStats> {
+        if !self.parallel {
+            return None;
+        }
+        let mut stats = TextureDecodeStats::default();
+        unsafe {
+            ffi::filament_gltfio_parallel_texture_provider_get_stats(
+                self.ptr.as_ptr() as *mut _,
+                &mut stats,
+            );
+        }
+        Some(stats)
+    }
+
+    /// Push one encoded image as `ResourceLoader` would. The texture is owned
+    /// by the caller, standing in for the asset.
+    #[cfg(test)]
+    pub fn push_texture(
+        &mut self,
+        engine: &mut Engine,
+        data: &[u8],
+        mime_type: &str,
+    ) -> Option<Texture> {
+        let mime_type = CString::new(mime_type).ok()?;
+        unsafe {
+            let ptr = ffi::filament_gltfio_texture_provider_push(
+                self.ptr.as_ptr() as *mut _,
+                data.as_ptr(),
+                data.len(),
+                mime_type.as_ptr(),
+                0,
+            );
+            NonNull::new(ptr as *mut c_void).map(|ptr| Texture {
+                ptr,
+                engine: engine.ptr,
+                owned: true,
+            })
+        }
+    }
+
+    /// Whether a finished texture was waiting to be popped.
+    #[cfg(test)]
+    pub fn pop_texture(&mut self) -> bool {
+        unsafe { !ffi::filament_gltfio_texture_provider_pop(self.ptr.as_ptr() as *mut _).is_null() }
+    }
+
+    #[cfg(test)]
+    pub fn wait_for_completion(&mut self) {
+        unsafe { ffi::filament_gltfio_texture_provider_wait(self.ptr.as_ptr() as *mut _) }
+    }
+
+    #[cfg(test)]
+    pub fn cancel_decoding(&mut self) {
+        unsafe { ffi::filament_gltfio_texture_provider_cancel(self.ptr.as_ptr() as *mut _) }
+    }
+
+    /// `(pushed, popped, decoded)` as reported to `ResourceLoader`.
+    #[cfg(test)]
+    pub fn counts(&self) -> (usize, usize, usize) {
+        let (mut pushed, mut popped, mut decoded) = (0, 0, 0);
+        unsafe {
+            ffi::filament_gltfio_texture_provider_get_counts(
+                self.ptr.as_ptr() as *mut _,
+                &mut pushed,
+                &mut popped,
+                &mut decoded,
+            );
+        }
+        (pushed, popped, decoded)
+    }
 }
 
 impl Drop for GltfTextureProvider {
@@ -1213,6 +1858,23 @@ impl GltfAssetLoader {
             })
         }
     }
+
+    /// Like `create_asset_from_json`, but the asset can grow more instances
+    /// with `GltfAsset::create_instance` while its source data is retained.
+    pub fn create_instanced_asset_from_json(&mut self, bytes: &[u8]) -> Option<GltfAsset> {
+        unsafe {
+            let ptr = ffi::filament_gltfio_asset_loader_create_instanced_asset(
+                self.ptr.as_ptr() as *mut _,
+                bytes.as_ptr(),
+                bytes.len() as u32,
+            );
+            NonNull::new(ptr as *mut c_void).map(|ptr| GltfAsset {
+                ptr,
+                loader: self.ptr,
+                engine: self.engine,
+            })
+        }
+    }
 }
 
 impl Drop for GltfAssetLoader {
@@ -1258,6 +1920,74 @@ impl GltfResourceLoader {
         }
     }
 
+    /// Point the loader at another glTF so it can be reused for the next asset.
+    pub fn set_configuration(
+        &mut self,
+        engine: &mut Engine,
+        gltf_path: Option<&str>,
+        normalize_skinning_weights: bool,
+    ) -> bool {
+        let c_path = match gltf_path.map(CString::new).transpose() {
+            Ok(path) => path,
+            Err(_) => {
+                log::warn!("Invalid glTF path (contains NUL byte).");
+                return false;
+            }
+        };
+        let path_ptr = c_path
+            .as_ref()
+            .map(|path| path.as_ptr())
+            .unwrap_or(std::ptr::null());
+        unsafe {
+            ffi::filament_gltfio_resource_loader_set_configuration(
+                self.ptr.as_ptr() as *mut _,
+                engine.ptr.as_ptr() as *mut _,
+                path_ptr,
+                normalize_skinning_weights,
+            );
+        }
+        true
+    }
+
+    /// Drop cached buffer data from the previous load.
+    pub fn evict_resource_data(&mut self) {
+        unsafe {
+            ffi::filament_gltfio_resource_loader_evict_resource_data(self.ptr.as_ptr() as *mut _);
+        }
+    }
+
+    /// Serve the glTF buffer named `uri` from `data[range]` instead of reading
+    /// it from disk. The loader holds a reference to `data` until
+    /// `evict_resource_data`; nothing is copied.
+    pub fn add_shared_resource_data<B>(&mut self, uri: &str, data: Arc<B>, range: Range<usize>)
+    where
+        B: AsRef<[u8]> + Send + Sync + 'static,
+    {
+        let c_uri = match CString::new(uri) {
+            Ok(uri) => uri,
+            Err(_) => {
+                log::warn!("Invalid resource URI (contains NUL byte).");
+                return;
+            }
+        };
+        let Some(bytes) = (*data).as_ref().get(range) else {
+            log::warn!("Resource range out of bounds for '{}'.", uri);
+            return;
+        };
+        let (ptr, size) = (bytes.as_ptr() as *const c_void, bytes.len());
+        let user = Arc::into_raw(data) as *mut c_void;
+        unsafe {
+            ffi::filament_gltfio_resource_loader_add_resource_data(
+                self.ptr.as_ptr() as *mut _,
+                c_uri.as_ptr(),
+                ptr,
+                size,
+                Some(release_shared_resource::<B>),
+                user,
+            );
+        }
+    }
+
     pub fn add_texture_provider(&mut self, mime_type: &str, provider: &mut GltfTextureProvider) {
         let c_mime = match CString::new(mime_type) {
             Ok(mime) => mime,
@@ -1283,6 +2013,38 @@ impl GltfResourceLoader {
             )
         }
     }
+
+    /// Start a non-blocking resource load. Buffers and textures are decoded on
+    /// the job system; call `async_update_load` once per frame until
+    /// `async_load_progress` reaches 1.0.
+    pub fn async_begin_load(&mut self, asset: &mut GltfAsset) -> bool {
+        unsafe {
+            ffi::filament_gltfio_resource_loader_async_begin_load(
+                self.ptr.as_ptr() as *mut _,
+                asset.ptr.as_ptr() as *mut _,
+            )
+        }
+    }
+
+    /// Upload decoded textures and advance the load. Must run on the engine thread.
+    pub fn async_update_load(&mut self) {
+        unsafe {
+            ffi::filament_gltfio_resource_loader_async_update_load(self.ptr.as_ptr() as *mut _);
+        }
+    }
+
+    /// Fraction of the pending load that has completed, in `[0, 1]`.
+    pub fn async_load_progress(&self) -> f32 {
+        unsafe {
+            ffi::filament_gltfio_resource_loader_async_get_load_progress(self.ptr.as_ptr() as *mut _)
+        }
+    }
+
+    pub fn async_cancel_load(&mut self) {
+        unsafe {
+            ffi::filament_gltfio_resource_loader_async_cancel_load(self.ptr.as_ptr() as *mut _);
+        }
+    }
 }
 
 impl Drop for GltfResourceLoader {
@@ -1300,10 +2062,19 @@ pub struct GltfAsset {
     engine: NonNull<c_void>,
 }
 
-impl GltfAsset {
-    pub fn add_entities_to_scene(&mut self, scene: &mut Scene) {
+impl GltfAsset {
+    pub fn add_entities_to_scene(&mut self, scene: &mut Scene) {
+        unsafe {
+            ffi::filament_gltfio_asset_add_entities_to_scene(
+                self.ptr.as_ptr() as *mut _,
+                scene.ptr.as_ptr() as *mut _,
+            );
+        }
+    }
+
+    pub fn remove_entities_from_scene(&mut self, scene: &mut Scene) {
         unsafe {
-            ffi::filament_gltfio_asset_add_entities_to_scene(
+            ffi::filament_gltfio_asset_remove_entities_from_scene(
                 self.ptr.as_ptr() as *mut _,
                 scene.ptr.as_ptr() as *mut _,
             );
@@ -1337,20 +2108,108 @@ impl GltfAsset {
     }
 
     pub fn material_instances(&mut self) -> (Vec<MaterialInstance>, Vec<String>) {
+        match self.instance() {
+            Some(instance) => instance.material_instances(),
+            None => (Vec::new(), Vec::new()),
+        }
+    }
+
+    /// The asset's first instance.
+    pub fn instance(&self) -> Option<GltfInstance> {
+        let ptr = unsafe { ffi::filament_gltfio_asset_get_instance(self.ptr.as_ptr() as *mut _) };
+        NonNull::new(ptr as *mut c_void).map(|ptr| GltfInstance {
+            ptr,
+            engine: self.engine,
+        })
+    }
+
+    /// Add an instance sharing this asset's buffers and textures. Only works for
+    /// assets created with `create_instanced_asset_from_json` whose source data
+    /// has not been released.
+    pub fn create_instance(&mut self) -> Option<GltfInstance> {
+        let ptr = unsafe {
+            ffi::filament_gltfio_asset_loader_create_instance(
+                self.loader.as_ptr() as *mut _,
+                self.ptr.as_ptr() as *mut _,
+            )
+        };
+        NonNull::new(ptr as *mut c_void).map(|ptr| GltfInstance {
+            ptr,
+            engine: self.engine,
+        })
+    }
+}
+
+impl Drop for GltfAsset {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::filament_gltfio_asset_loader_destroy_asset(
+                self.loader.as_ptr() as *mut _,
+                self.ptr.as_ptr() as *mut _,
+            );
+        }
+    }
+}
+
+/// gltfio asset instance (borrowed; owned by its `GltfAsset`)
+pub struct GltfInstance {
+    ptr: NonNull<c_void>,
+    engine: NonNull<c_void>,
+}
+
+impl GltfInstance {
+    pub fn add_entities_to_scene(&self, scene: &mut Scene) {
+        unsafe {
+            ffi::filament_gltfio_instance_add_entities_to_scene(
+                self.ptr.as_ptr() as *mut _,
+                scene.ptr.as_ptr() as *mut _,
+            );
+        }
+    }
+
+    pub fn remove_entities_from_scene(&self, scene: &mut Scene) {
+        unsafe {
+            ffi::filament_gltfio_instance_remove_entities_from_scene(
+                self.ptr.as_ptr() as *mut _,
+                scene.ptr.as_ptr() as *mut _,
+            );
+        }
+    }
+
+    pub fn root_entity(&self) -> Entity {
+        let id = unsafe { ffi::filament_gltfio_instance_get_root(self.ptr.as_ptr() as *mut _) };
+        Entity { id }
+    }
+
+    pub fn renderable_entities(&self) -> Vec<Entity> {
+        let count =
+            unsafe { ffi::filament_gltfio_instance_get_entity_count(self.ptr.as_ptr() as *mut _) };
+        if count <= 0 {
+            return Vec::new();
+        }
+        let mut ids = vec![0i32; count as usize];
+        let actual = unsafe {
+            ffi::filament_gltfio_instance_get_renderable_entities(
+                self.engine.as_ptr() as *mut _,
+                self.ptr.as_ptr() as *mut _,
+                ids.as_mut_ptr(),
+                count,
+            )
+        };
+        ids.truncate(actual.max(0) as usize);
+        ids.into_iter().map(|id| Entity { id }).collect()
+    }
+
+    pub fn material_instances(&self) -> (Vec<MaterialInstance>, Vec<String>) {
         let mut instances = Vec::new();
         let mut names = Vec::new();
-        let instance_ptr =
-            unsafe { ffi::filament_gltfio_asset_get_instance(self.ptr.as_ptr() as *mut _) };
-        let Some(instance) = NonNull::new(instance_ptr as *mut c_void) else {
-            return (instances, names);
-        };
         let count = unsafe {
-            ffi::filament_gltfio_instance_get_material_instance_count(instance.as_ptr() as *mut _)
+            ffi::filament_gltfio_instance_get_material_instance_count(self.ptr.as_ptr() as *mut _)
         };
         for index in 0..count {
             let mi_ptr = unsafe {
                 ffi::filament_gltfio_instance_get_material_instance(
-                    instance.as_ptr() as *mut _,
+                    self.ptr.as_ptr() as *mut _,
                     index,
                 )
             };
@@ -1368,14 +2227,48 @@ impl GltfAsset {
     }
 }
 
-impl Drop for GltfAsset {
-    fn drop(&mut self) {
-        unsafe {
-            ffi::filament_gltfio_asset_loader_destroy_asset(
-                self.loader.as_ptr() as *mut _,
-                self.ptr.as_ptr() as *mut _,
-            );
-        }
+/// `EXT_meshopt_compression` buffer view mode
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(u32)]
+pub enum MeshoptMode {
+    Attributes = ffi::MESHOPT_MODE_ATTRIBUTES,
+    Triangles = ffi::MESHOPT_MODE_TRIANGLES,
+    Indices = ffi::MESHOPT_MODE_INDICES,
+}
+
+/// `EXT_meshopt_compression` buffer view filter
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(u32)]
+pub enum MeshoptFilter {
+    None = ffi::MESHOPT_FILTER_NONE,
+    Octahedral = ffi::MESHOPT_FILTER_OCTAHEDRAL,
+    Quaternion = ffi::MESHOPT_FILTER_QUATERNION,
+    Exponential = ffi::MESHOPT_FILTER_EXPONENTIAL,
+}
+
+/// Decode a compressed buffer view of `count` elements of `stride` bytes into
+/// `dst`. Safe to call from any thread. Returns false on malformed input.
+pub fn meshopt_decode_buffer_view(
+    mode: MeshoptMode,
+    filter: MeshoptFilter,
+    count: usize,
+    stride: usize,
+    src: &[u8],
+    dst: &mut [u8],
+) -> bool {
+    if count.checked_mul(stride) != Some(dst.len()) {
+        return false;
+    }
+    unsafe {
+        ffi::filament_meshopt_decode_buffer_view(
+            mode as u32,
+            filter as u32,
+            count,
+            stride,
+            src.as_ptr(),
+            src.len(),
+            dst.as_mut_ptr(),
+        )
     }
 }
 
@@ -1788,6 +2681,54 @@ impl VertexBuffer {
         }
     }
 
+    /// Upload a pooled buffer without copying. Filament reads `data` in place and
+    /// hands it back to `pool` once the driver is done with it.
+    pub fn set_buffer_at_pooled<T: Copy + Default + Send + 'static>(
+        &mut self,
+        buffer_index: u8,
+        pool: &UploadPool<T>,
+        data: Vec<T>,
+        dest_offset: u32,
+    ) {
+        let Some((ptr, size, user)) = pool.submit(data) else {
+            return;
+        };
+        unsafe {
+            ffi::filament_vertex_buffer_set_buffer_at_owned(
+                self.ptr.as_ptr() as *mut _,
+                self.engine.as_ptr() as *mut _,
+                buffer_index,
+                ptr,
+                size,
+                dest_offset,
+                Some(release_pooled_upload::<T>),
+                user,
+            );
+        }
+    }
+
+    /// Copy `data` into the current frame of `ring` instead of a fresh
+    /// allocation. Falls back to the allocating path when the ring is full.
+    pub fn set_buffer_at_ring<T>(
+        &mut self,
+        ring: &mut StagingRing,
+        buffer_index: u8,
+        data: &[T],
+        dest_offset: u32,
+    ) {
+        unsafe {
+            ffi::filament_vertex_buffer_set_buffer_at_ring(
+                self.ptr.as_ptr() as *mut _,
+                self.engine.as_ptr() as *mut _,
+                ring.ptr.as_ptr() as *mut _,
+                buffer_index,
+                data.as_ptr() as *const c_void,
+                data.len() * std::mem::size_of::<T>(),
+                dest_offset,
+            );
+        }
+    }
+
     pub fn as_ptr(&self) -> *mut c_void {
         self.ptr.as_ptr()
     }
@@ -1847,11 +2788,179 @@ impl IndexBuffer {
         }
     }
 
+    /// Upload a pooled buffer without copying. Filament reads `data` in place and
+    /// hands it back to `pool` once the driver is done with it.
+    pub fn set_buffer_pooled<T: Copy + Default + Send + 'static>(
+        &mut self,
+        pool: &UploadPool<T>,
+        data: Vec<T>,
+        dest_offset: u32,
+    ) {
+        let Some((ptr, size, user)) = pool.submit(data) else {
+            return;
+        };
+        unsafe {
+            ffi::filament_index_buffer_set_buffer_owned(
+                self.ptr.as_ptr() as *mut _,
+                self.engine.as_ptr() as *mut _,
+                ptr,
+                size,
+                dest_offset,
+                Some(release_pooled_upload::<T>),
+                user,
+            );
+        }
+    }
+
     pub fn as_ptr(&self) -> *mut c_void {
         self.ptr.as_ptr()
     }
 }
 
+/// Recycles upload buffers that are handed to Filament without copying.
+///
+/// `acquire` returns a buffer to fill, the `*_pooled` upload calls give it to
+/// Filament, and the driver's release callback puts it back on the free list.
+/// Once every buffer size in use has been seen, uploads stop allocating.
+pub struct UploadPool<T: Copy + Default + Send + 'static> {
+    state: Arc<Mutex<UploadPoolState<T>>>,
+}
+
+struct UploadPoolState<T> {
+    free: Vec<Vec<T>>,
+    in_flight: Vec<Vec<T>>,
+}
+
+impl<T: Copy + Default + Send + 'static> UploadPool<T> {
+    pub fn new() -> Self {
+        Self {
+            state: Arc::new(Mutex::new(UploadPoolState {
+                free: Vec::new(),
+                in_flight: Vec::new(),
+            })),
+        }
+    }
+
+    /// Take a buffer of exactly `len` elements. Recycled buffers keep whatever
+    /// they held last time, so callers must overwrite every element they upload.
+    pub fn acquire(&self, len: usize) -> Vec<T> {
+        let recycled = self.state.lock().ok().and_then(|mut state| {
+            let index = state
+                .free
+                .iter()
+                .position(|buffer| buffer.capacity() >= len)?;
+            Some(state.free.swap_remove(index))
+        });
+        match recycled {
+            Some(mut buffer) => {
+                buffer.resize(len, T::default());
+                buffer
+            }
+            None => vec![T::default(); len],
+        }
+    }
+
+    /// Number of buffers currently owned by Filament.
+    pub fn in_flight_count(&self) -> usize {
+        self.state
+            .lock()
+            .map(|state| state.in_flight.len())
+            .unwrap_or(0)
+    }
+
+    /// Move `data` to the in-flight list and return the pointer, byte size and
+    /// callback user pointer for an `*_owned` FFI upload. Empty buffers go
+    /// straight back to the free list.
+    fn submit(&self, data: Vec<T>) -> Option<(*mut c_void, usize, *mut c_void)> {
+        let mut state = self.state.lock().ok()?;
+        if data.is_empty() {
+            state.free.push(data);
+            return None;
+        }
+        let ptr = data.as_ptr() as *mut c_void;
+        let size = data.len() * std::mem::size_of::<T>();
+        state.in_flight.push(data);
+        let user = Arc::into_raw(Arc::clone(&self.state)) as *mut c_void;
+        Some((ptr, size, user))
+    }
+}
+
+impl<T: Copy + Default + Send + 'static> Default for UploadPool<T> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// Release callback for pooled uploads. May run on a Filament thread, so it only
+/// touches the mutex-guarded pool state it was given.
+unsafe extern "C" fn release_pooled_upload<T: Copy + Default + Send + 'static>(
+    buffer: *mut c_void,
+    _size: usize,
+    user: *mut c_void,
+) {
+    if user.is_null() {
+        return;
+    }
+    let state = Arc::from_raw(user as *const Mutex<UploadPoolState<T>>);
+    if let Ok(mut state) = state.lock() {
+        if let Some(index) = state
+            .in_flight
+            .iter()
+            .position(|data| data.as_ptr() as *mut c_void == buffer)
+        {
+            let data = state.in_flight.swap_remove(index);
+            state.free.push(data);
+        }
+    };
+}
+
+/// Release callback for `GltfResourceLoader::add_shared_resource_data`; drops
+/// the loader's reference to the shared bytes.
+unsafe extern "C" fn release_shared_resource<B: AsRef<[u8]> + Send + Sync + 'static>(
+    _buffer: *mut c_void,
+    _size: usize,
+    user: *mut c_void,
+) {
+    if !user.is_null() {
+        drop(Arc::from_raw(user as *const B));
+    }
+}
+
+pub type StagingRingStats = ffi::StagingRingStats;
+pub type ProgramCacheStats = ffi::ProgramCacheStatsC;
+
+/// Frame-indexed staging memory for dynamic geometry uploads. Call
+/// `advance_frame` once per rendered frame; a slot is reused only after
+/// Filament has released every upload copied into it.
+pub struct StagingRing {
+    ptr: NonNull<c_void>,
+}
+
+impl StagingRing {
+    pub fn advance_frame(&mut self) {
+        unsafe {
+            ffi::filament_staging_ring_advance_frame(self.ptr.as_ptr() as *mut _);
+        }
+    }
+
+    pub fn stats(&self) -> StagingRingStats {
+        let mut stats = StagingRingStats::default();
+        unsafe {
+            ffi::filament_staging_ring_get_stats(self.ptr.as_ptr() as *const _, &mut stats);
+        }
+        stats
+    }
+}
+
+impl Drop for StagingRing {
+    fn drop(&mut self) {
+        // In-flight uploads keep the native ring alive until they are released.
+        unsafe {
+            ffi::filament_staging_ring_destroy(self.ptr.as_ptr() as *mut _);
+        }
+    }
+}
+
 /// Renderable builder
 pub struct RenderableBuilder {
     ptr: *mut c_void,
@@ -1984,6 +3093,60 @@ impl Drop for RenderTarget {
     }
 }
 
+/// Batched material + layer mask override for renderables.
+///
+/// `push` swaps every primitive of each entity to an override material and
+/// records the original state on the C++ side; `pop` restores all of it.
+/// A pass over N entities costs two FFI calls regardless of primitive count.
+pub struct MaterialOverrideSet {
+    ptr: NonNull<c_void>,
+    // Scratch arrays reused across pushes to keep steady-state frames allocation-free.
+    entity_ids: Vec<i32>,
+    instances: Vec<*mut c_void>,
+    layer_values: Vec<u8>,
+}
+
+impl MaterialOverrideSet {
+    /// Override materials and layer masks. Returns the number of primitives swapped.
+    pub fn push(&mut self, overrides: &[(Entity, &MaterialInstance, u8)]) -> i32 {
+        if overrides.is_empty() {
+            return 0;
+        }
+        self.entity_ids.clear();
+        self.instances.clear();
+        self.layer_values.clear();
+        for (entity, material_instance, layer_value) in overrides {
+            self.entity_ids.push(entity.id);
+            self.instances.push(material_instance.ptr.as_ptr());
+            self.layer_values.push(*layer_value);
+        }
+        unsafe {
+            ffi::filament_material_override_set_push(
+                self.ptr.as_ptr() as *mut _,
+                self.entity_ids.as_ptr(),
+                self.instances.as_ptr() as *const *mut ffi::MaterialInstance,
+                self.layer_values.as_ptr(),
+                self.entity_ids.len(),
+            )
+        }
+    }
+
+    /// Restore every material and layer mask saved since the last pop.
+    pub fn pop(&mut self) {
+        unsafe {
+            ffi::filament_material_override_set_pop(self.ptr.as_ptr() as *mut _);
+        }
+    }
+}
+
+impl Drop for MaterialOverrideSet {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::filament_material_override_set_destroy(self.ptr.as_ptr() as *mut _);
+        }
+    }
+}
+
 // --- Engine extensions for pick pass ---
 
 impl Engine {
@@ -2033,6 +3196,19 @@ impl Engine {
         }
     }
 
+    /// Create an empty material override set bound to this engine.
+    pub fn create_material_override_set(&mut self) -> Option<MaterialOverrideSet> {
+        unsafe {
+            let ptr = ffi::filament_material_override_set_create(self.ptr.as_ptr() as *mut _);
+            NonNull::new(ptr as *mut c_void).map(|ptr| MaterialOverrideSet {
+                ptr,
+                entity_ids: Vec::new(),
+                instances: Vec::new(),
+                layer_values: Vec::new(),
+            })
+        }
+    }
+
     /// Get the number of primitives on a renderable entity.
     pub fn renderable_primitive_count(&mut self, entity: Entity) -> i32 {
         unsafe {
@@ -2146,6 +3322,30 @@ impl Renderer {
         }
     }
 
+    /// Schedule a non-blocking readback into `readback`. Poll it on later frames
+    /// instead of flushing; fails if the slot is still busy.
+    pub fn read_pixels_async(
+        &mut self,
+        render_target: &RenderTarget,
+        x: u32,
+        y: u32,
+        width: u32,
+        height: u32,
+        readback: &mut AsyncReadback,
+    ) -> bool {
+        unsafe {
+            ffi::filament_renderer_read_pixels_async(
+                self.ptr.as_ptr() as *mut _,
+                render_target.ptr.as_ptr() as *mut _,
+                x,
+                y,
+                width,
+                height,
+                readback.ptr.as_ptr() as *mut _,
+            )
+        }
+    }
+
     /// Schedule a pixel readback from the current swap chain frame.
     /// Call *after* end_frame() and *before* next begin_frame().
     pub fn read_pixels_swap_chain(
@@ -2170,6 +3370,83 @@ impl Renderer {
     }
 }
 
+/// Reusable destination for `Renderer::read_pixels_async`. The native slot
+/// owns its pixel storage, so dropping it mid-flight is safe.
+pub struct AsyncReadback {
+    ptr: NonNull<c_void>,
+}
+
+impl AsyncReadback {
+    pub fn new(capacity_bytes: u32) -> Option<Self> {
+        unsafe {
+            let ptr = ffi::filament_async_readback_create(capacity_bytes);
+            NonNull::new(ptr as *mut c_void).map(|ptr| Self { ptr })
+        }
+    }
+
+    /// Whether a readback is in flight or completed but not yet polled.
+    pub fn is_busy(&self) -> bool {
+        unsafe { ffi::filament_async_readback_is_busy(self.ptr.as_ptr() as *const _) }
+    }
+
+    /// Copy out a completed readback and free the slot. Returns `false` while
+    /// the readback is still in flight.
+    pub fn poll(&mut self, out: &mut [u8]) -> bool {
+        unsafe {
+            ffi::filament_async_readback_poll(
+                self.ptr.as_ptr() as *mut _,
+                out.as_mut_ptr(),
+                out.len() as u32,
+            ) > 0
+        }
+    }
+}
+
+impl Drop for AsyncReadback {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::filament_async_readback_destroy(self.ptr.as_ptr() as *mut _);
+        }
+    }
+}
+
+pub type ViewPickResult = ffi::ViewPickResult;
+
+/// Reusable slot for `View::pick` results. Dropping it mid-flight is safe.
+pub struct ViewPickQuery {
+    ptr: NonNull<c_void>,
+}
+
+impl ViewPickQuery {
+    pub fn new() -> Option<Self> {
+        unsafe {
+            let ptr = ffi::filament_view_pick_query_create();
+            NonNull::new(ptr as *mut c_void).map(|ptr| Self { ptr })
+        }
+    }
+
+    /// Whether a query is in flight or completed but not yet polled.
+    pub fn is_busy(&self) -> bool {
+        unsafe { ffi::filament_view_pick_query_is_busy(self.ptr.as_ptr() as *const _) }
+    }
+
+    /// Take a completed result and free the slot.
+    pub fn poll(&mut self) -> Option<ViewPickResult> {
+        let mut result = ViewPickResult::default();
+        let ready =
+            unsafe { ffi::filament_view_pick_query_poll(self.ptr.as_ptr() as *mut _, &mut result) };
+        ready.then_some(result)
+    }
+}
+
+impl Drop for ViewPickQuery {
+    fn drop(&mut self) {
+        unsafe {
+            ffi::filament_view_pick_query_destroy(self.ptr.as_ptr() as *mut _);
+        }
+    }
+}
+
 // --- GltfAsset extensions for pick pass ---
 
 impl GltfAsset {
@@ -2198,3 +3475,43 @@ impl GltfAsset {
         ids.into_iter().map(|id| Entity { id }).collect()
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn png_bytes() -> Vec<u8> {
+        let image = image::RgbaImage::from_pixel(4, 4, image::Rgba([255, 0, 0, 255]));
+        let mut bytes = std::io::Cursor::new(Vec::new());
+        image
+            .write_to(&mut bytes, image::ImageFormat::Png)
+            .expect("encode png");
+        bytes.into_inner()
+    }
+
+    #[test]
+    fn parallel_provider_cancel_drops_unpopped_textures() {
+        let mut engine = Engine::create(Backend::Noop).expect("noop engine");
+        let mut provider = GltfTextureProvider::create_parallel(&mut engine, 1, 0).unwrap();
+        let png = png_bytes();
+        let first = provider.push_texture(&mut engine, &png, "image/png");
+        let second = provider.push_texture(&mut engine, &png, "image/png");
+        assert!(first.is_some() && second.is_some());
+
+        // Both are uploaded and queued; take one, then cancel with the other
+        // still in the pop queue.
+        provider.wait_for_completion();
+        assert!(provider.pop_texture());
+        assert_eq!(provider.counts(), (2, 1, 2));
+        provider.cancel_decoding();
+        assert_eq!(provider.counts(), (2, 2, 2));
+        assert!(!provider.pop_texture());
+
+        // The next load starts from balanced counters.
+        let third = provider.push_texture(&mut engine, &png, "image/png");
+        provider.wait_for_completion();
+        assert!(provider.pop_texture());
+        assert_eq!(provider.counts(), (3, 3, 3));
+        drop((first, second, third, provider));
+    }
+}
@@ -1,6 +1,6 @@
 use crate::filament::{
     ElementType, Engine, Entity, EntityManager, IndexBuffer, IndexType, Material, MaterialInstance,
-    PrimitiveType, RenderableBuilder, Scene, VertexAttribute, VertexBuffer,
+    PrimitiveType, RenderableBuilder, Scene, StagingRing, VertexAttribute, VertexBuffer,
 };
 use crate::render::{PickKey, PickKind};
 use glam::{Mat3, Mat4, Vec3};
@@ -42,7 +42,7 @@ struct LineHandleState {
     positions: Vec<[f32; 3]>,
 }
 
-#[derive(Clone, Copy)]
+#[derive(Clone, Copy, PartialEq)]
 pub struct GizmoParams {
     pub visible: bool,
     pub mode: i32,
@@ -154,19 +154,28 @@ impl EditorOverlay {
         })
     }
 
-    pub fn set_params(&mut self, engine: &mut Engine, params: GizmoParams) {
+    pub fn set_params(
+        &mut self,
+        engine: &mut Engine,
+        staging_ring: Option<&mut StagingRing>,
+        params: GizmoParams,
+    ) {
         self.params = params;
         self.update_handle_visibility(engine);
-        self.update_line_geometry();
+        self.update_line_geometry(staging_ring);
         self.update_handle_transforms(engine);
     }
 
-    pub fn set_pick_width_mode(&mut self, enabled: bool) {
+    pub fn params(&self) -> &GizmoParams {
+        &self.params
+    }
+
+    pub fn set_pick_width_mode(&mut self, staging_ring: Option<&mut StagingRing>, enabled: bool) {
         if self.pick_width_mode == enabled {
             return;
         }
         self.pick_width_mode = enabled;
-        self.update_line_geometry();
+        self.update_line_geometry(staging_ring);
     }
 
     pub fn attach_to_scene(&self, scene: &mut Scene) {
@@ -260,7 +269,7 @@ impl EditorOverlay {
         }
     }
 
-    fn update_line_geometry(&mut self) {
+    fn update_line_geometry(&mut self, mut staging_ring: Option<&mut StagingRing>) {
         let origin = Vec3::from_array(self.params.origin);
         let axis_len = self.params.axis_world_len.max(0.0001);
         let camera_position = Vec3::from_array(self.params.camera_position);
@@ -343,10 +352,18 @@ impl EditorOverlay {
                 line_state.positions[base + 2] = collapse;
                 line_state.positions[base + 3] = collapse;
             }
-            handle
-                ._mesh
-                .vertex
-                .set_buffer_at(0, &line_state.positions, 0);
+            match staging_ring.as_deref_mut() {
+                Some(ring) => {
+                    handle
+                        ._mesh
+                        .vertex
+                        .set_buffer_at_ring(ring, 0, &line_state.positions, 0)
+                }
+                None => handle
+                    ._mesh
+                    .vertex
+                    .set_buffer_at(0, &line_state.positions, 0),
+            }
         }
     }
 
@@ -363,9 +380,10 @@ impl EditorOverlay {
         };
 
         let identity = Mat4::IDENTITY.to_cols_array();
+        let mut transforms = Vec::with_capacity(self.handles.len());
         for handle in &self.handles {
             if handle.world_space_geometry {
-                tm.set_transform(handle.entity, &identity);
+                transforms.push((handle.entity, identity));
                 continue;
             }
             let basis = if handle.billboard_to_camera {
@@ -376,8 +394,9 @@ impl EditorOverlay {
             let world = Mat4::from_translation(origin)
                 * Mat4::from_mat3(basis)
                 * Mat4::from_scale(Vec3::splat(axis_len));
-            tm.set_transform(handle.entity, &world.to_cols_array());
+            transforms.push((handle.entity, world.to_cols_array()));
         }
+        tm.set_transforms(&transforms);
     }
 
     fn is_handle_mode_visible(&self, handle_id: i32) -> bool {
@@ -1,7 +1,7 @@
 use crate::filament::{
     Camera, ElementType, Engine, Entity, IndexBuffer, IndexType, Material, MaterialInstance,
     PrimitiveType, RenderTarget, Renderer, Scene, Texture, TextureInternalFormat, TextureUsage,
-    VertexAttribute, VertexBuffer, View,
+    UploadPool, VertexAttribute, VertexBuffer, View,
 };
 
 const MAX_VERTICES: usize = 96_000;
@@ -33,6 +33,13 @@ pub struct EguiOverlay {
     uvs: Vec<[f32; 2]>,
     colors: Vec<[u8; 4]>,
     indices: Vec<u32>,
+    // Mesh and atlas buffers are handed to Filament without copying and come
+    // back through these pools once the driver releases them.
+    position_pool: UploadPool<[f32; 3]>,
+    uv_pool: UploadPool<[f32; 2]>,
+    color_pool: UploadPool<[u8; 4]>,
+    index_pool: UploadPool<u32>,
+    atlas_upload_pool: UploadPool<u8>,
     last_index_count: usize,
     warned_texture_mismatch: bool,
     warned_mesh_overflow: bool,
@@ -127,6 +134,11 @@ impl EguiOverlay {
             uvs,
             colors,
             indices,
+            position_pool: UploadPool::new(),
+            uv_pool: UploadPool::new(),
+            color_pool: UploadPool::new(),
+            index_pool: UploadPool::new(),
+            atlas_upload_pool: UploadPool::new(),
             last_index_count: 1,
             warned_texture_mismatch: false,
             warned_mesh_overflow: false,
@@ -276,7 +288,17 @@ impl EguiOverlay {
             self.atlas_texture_size = Some([w, h]);
         }
         if let Some(texture) = self.atlas_texture.as_mut() {
-            if !engine.set_texture_image_rgba8(texture, w, h, &self.atlas_pixels) {
+            // The CPU atlas is patched incrementally, so it stays resident and the
+            // upload goes through a pooled snapshot instead of a bridge-side malloc.
+            let mut upload = self.atlas_upload_pool.acquire(self.atlas_pixels.len());
+            upload.copy_from_slice(&self.atlas_pixels);
+            if !engine.set_texture_image_rgba8_pooled(
+                texture,
+                w,
+                h,
+                &self.atlas_upload_pool,
+                upload,
+            ) {
                 return Err("failed to upload egui atlas texture".to_string());
             }
         } else {
@@ -408,11 +430,11 @@ impl EguiOverlay {
             self.indices[index] = 0;
         }
         self.last_index_count = index_count.max(1);
-        if vertex_count == 1 {
-            self.positions[0] = [0.0, 0.0, 0.0];
-            self.uvs[0] = [0.0, 0.0];
-            self.colors[0] = [0, 0, 0, 0];
-        }
+        // Vertex 0 backs the zeroed index tail; reset it every frame since mesh
+        // buffers are recycled from the upload pools.
+        self.positions[0] = [0.0, 0.0, 0.0];
+        self.uvs[0] = [0.0, 0.0];
+        self.colors[0] = [0, 0, 0, 0];
         for index in 0..self.last_index_count {
             if self.indices[index] as usize >= vertex_count {
                 self.indices[index] = 0;
@@ -421,15 +443,26 @@ impl EguiOverlay {
     }
 
     fn upload_mesh(&mut self) {
+        // Hand this frame's buffers to Filament and build the next frame into
+        // recycled ones. build_mesh rewrites every vertex it references and zeroes
+        // the unused index tail, so stale recycled contents are never drawn.
+        let positions = std::mem::replace(
+            &mut self.positions,
+            self.position_pool.acquire(MAX_VERTICES),
+        );
+        let uvs = std::mem::replace(&mut self.uvs, self.uv_pool.acquire(MAX_VERTICES));
+        let colors = std::mem::replace(&mut self.colors, self.color_pool.acquire(MAX_VERTICES));
+        let indices = std::mem::replace(&mut self.indices, self.index_pool.acquire(MAX_INDICES));
         self.vertex_buffer
-            .set_buffer_at(0, &self.positions[..MAX_VERTICES.min(self.positions.len())], 0);
+            .set_buffer_at_pooled(0, &self.position_pool, positions, 0);
         self.vertex_buffer
-            .set_buffer_at(1, &self.uvs[..MAX_VERTICES.min(self.uvs.len())], 0);
+            .set_buffer_at_pooled(1, &self.uv_pool, uvs, 0);
         self.vertex_buffer
-            .set_buffer_at(2, &self.colors[..MAX_VERTICES.min(self.colors.len())], 0);
+            .set_buffer_at_pooled(2, &self.color_pool, colors, 0);
         // Filament renderables created with a fixed index count can still consume
         // the full index range; upload the full buffer with unused entries zeroed.
-        self.index_buffer.set_buffer(&self.indices[..MAX_INDICES], 0);
+        self.index_buffer
+            .set_buffer_pooled(&self.index_pool, indices, 0);
     }
 }
 
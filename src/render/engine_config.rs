@@ -0,0 +1,192 @@
+//! Engine::Config presets and overrides.
+//!
+//! The config an engine is created with is built from a preset, then an
+//! optional JSON config file, then individual CLI flags; later sources win
+//! field by field.
+
+use crate::filament::EngineConfig;
+use serde::Deserialize;
+use std::path::Path;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum EnginePreset {
+    /// Filament's own defaults.
+    Default,
+    /// Large command buffers and arenas for scenes with many renderables.
+    HeavyScene,
+    /// Minimum buffer sizes and a small resource cache for playback.
+    LowMemory,
+}
+
+impl EnginePreset {
+    pub fn from_str(value: &str) -> Option<Self> {
+        match value.trim().to_ascii_lowercase().as_str() {
+            "default" => Some(Self::Default),
+            "heavy" | "heavy-scene" => Some(Self::HeavyScene),
+            "low-memory" | "low-mem" => Some(Self::LowMemory),
+            _ => None,
+        }
+    }
+
+    pub fn as_str(self) -> &'static str {
+        match self {
+            Self::Default => "default",
+            Self::HeavyScene => "heavy-scene",
+            Self::LowMemory => "low-memory",
+        }
+    }
+
+    pub fn config(self) -> EngineConfig {
+        match self {
+            Self::Default => EngineConfig::default(),
+            Self::HeavyScene => EngineConfig {
+                command_buffer_size_mb: 48,
+                per_render_pass_arena_size_mb: 64,
+                driver_handle_arena_size_mb: 32,
+                min_command_buffer_size_mb: 16,
+                per_frame_commands_size_mb: 32,
+                job_system_thread_count: 0,
+                resource_allocator_cache_size_mb: 256,
+                resource_allocator_cache_max_age: 0,
+            },
+            Self::LowMemory => EngineConfig {
+                command_buffer_size_mb: 3,
+                per_render_pass_arena_size_mb: 3,
+                driver_handle_arena_size_mb: 0,
+                min_command_buffer_size_mb: 1,
+                per_frame_commands_size_mb: 2,
+                job_system_thread_count: 2,
+                resource_allocator_cache_size_mb: 16,
+                resource_allocator_cache_max_age: 1,
+            },
+        }
+    }
+}
+
+/// Per-field overrides from a config file or CLI flags; `None` keeps the base
+/// value. A config file may also name the preset to start from.
+#[derive(Debug, Clone, Default, PartialEq, Eq, Deserialize)]
+#[serde(default, deny_unknown_fields)]
+pub struct EngineConfigOverrides {
+    pub preset: Option<String>,
+    pub command_buffer_size_mb: Option<u32>,
+    pub per_render_pass_arena_size_mb: Option<u32>,
+    pub driver_handle_arena_size_mb: Option<u32>,
+    pub min_command_buffer_size_mb: Option<u32>,
+    pub per_frame_commands_size_mb: Option<u32>,
+    pub job_system_thread_count: Option<u32>,
+    pub resource_allocator_cache_size_mb: Option<u32>,
+    pub resource_allocator_cache_max_age: Option<u32>,
+}
+
+impl EngineConfigOverrides {
+    /// Load overrides from a JSON config file.
+    pub fn load(path: &Path) -> Result<Self, String> {
+        let text = std::fs::read_to_string(path)
+            .map_err(|err| format!("failed to read {}: {}", path.display(), err))?;
+        Self::from_json(&text).map_err(|err| format!("{}: {}", path.display(), err))
+    }
+
+    pub fn from_json(text: &str) -> Result<Self, String> {
+        serde_json::from_str(text).map_err(|err| err.to_string())
+    }
+
+    /// Set the field for an `--engine-*` sizing flag. Returns `Ok(false)` when
+    /// `flag` is not a sizing flag.
+    pub fn set_flag(&mut self, flag: &str, value: &str) -> Result<bool, String> {
+        let field = match flag {
+            "--engine-command-buffer-mb" => &mut self.command_buffer_size_mb,
+            "--engine-per-render-pass-arena-mb" => &mut self.per_render_pass_arena_size_mb,
+            "--engine-driver-handle-arena-mb" => &mut self.driver_handle_arena_size_mb,
+            "--engine-min-command-buffer-mb" => &mut self.min_command_buffer_size_mb,
+            "--engine-per-frame-commands-mb" => &mut self.per_frame_commands_size_mb,
+            "--engine-job-threads" => &mut self.job_system_thread_count,
+            "--engine-resource-cache-mb" => &mut self.resource_allocator_cache_size_mb,
+            "--engine-resource-cache-age" => &mut self.resource_allocator_cache_max_age,
+            _ => return Ok(false),
+        };
+        let parsed = value
+            .trim()
+            .parse::<u32>()
+            .map_err(|_| format!("{flag} expects a non-negative integer, got '{value}'"))?;
+        *field = Some(parsed);
+        Ok(true)
+    }
+
+    pub fn apply(&self, config: &mut EngineConfig) {
+        fn set(value: Option<u32>, field: &mut u32) {
+            if let Some(value) = value {
+                *field = value;
+            }
+        }
+        set(
+            self.command_buffer_size_mb,
+            &mut config.command_buffer_size_mb,
+        );
+        set(
+            self.per_render_pass_arena_size_mb,
+            &mut config.per_render_pass_arena_size_mb,
+        );
+        set(
+            self.driver_handle_arena_size_mb,
+            &mut config.driver_handle_arena_size_mb,
+        );
+        set(
+            self.min_command_buffer_size_mb,
+            &mut config.min_command_buffer_size_mb,
+        );
+        set(
+            self.per_frame_commands_size_mb,
+            &mut config.per_frame_commands_size_mb,
+        );
+        set(
+            self.job_system_thread_count,
+            &mut config.job_system_thread_count,
+        );
+        set(
+            self.resource_allocator_cache_size_mb,
+            &mut config.resource_allocator_cache_size_mb,
+        );
+        set(
+            self.resource_allocator_cache_max_age,
+            &mut config.resource_allocator_cache_max_age,
+        );
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn overrides_apply_over_preset() {
+        let overrides = EngineConfigOverrides::from_json(
+            r#"{ "preset": "heavy-scene", "job_system_thread_count": 6 }"#,
+        )
+        .expect("valid overrides");
+        let preset = overrides
+            .preset
+            .as_deref()
+            .and_then(EnginePreset::from_str)
+            .expect("known preset");
+        assert_eq!(preset, EnginePreset::HeavyScene);
+
+        let mut config = preset.config();
+        overrides.apply(&mut config);
+        assert_eq!(config.job_system_thread_count, 6);
+        assert_eq!(config.command_buffer_size_mb, 48);
+
+        let mut flags = EngineConfigOverrides::default();
+        assert_eq!(flags.set_flag("--engine-command-buffer-mb", "96"), Ok(true));
+        assert_eq!(flags.set_flag("--ui-backend", "egui"), Ok(false));
+        assert!(flags.set_flag("--engine-job-threads", "-1").is_err());
+        flags.apply(&mut config);
+        assert_eq!(config.command_buffer_size_mb, 96);
+        assert_eq!(config.job_system_thread_count, 6);
+    }
+
+    #[test]
+    fn overrides_reject_unknown_fields() {
+        assert!(EngineConfigOverrides::from_json(r#"{ "command_buffer_mb": 8 }"#).is_err());
+    }
+}
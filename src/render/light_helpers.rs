@@ -19,7 +19,7 @@ struct LightHelperEntry {
     _mesh: MeshResource,
 }
 
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone, Copy, PartialEq)]
 pub struct LightHelperSpec {
     pub object_id: u64,
     pub object_index: u32,
@@ -1,22 +1,31 @@
 mod camera;
 mod egui_overlay;
 mod editor_overlay;
+mod engine_config;
 mod light_helpers;
 pub mod pick;
 
 pub use camera::{CameraController, CameraMovement};
 pub use editor_overlay::GizmoParams;
+pub use engine_config::{EngineConfigOverrides, EnginePreset};
 pub use light_helpers::LightHelperSpec;
-pub use pick::{PickHit, PickKey, PickKind, PickSystem};
+pub use pick::{
+    PickBackend, PickHit, PickKey, PickKind, PickReadbackMode, PickRegionHit, PickSceneState,
+    PickStats, PickSystem,
+};
 
 use crate::filament::{
-    Backend, Camera, Engine, Entity, ImGuiHelper, IndirectLight, LightParams, Material,
-    MaterialInstance,
-    Renderer, Scene, Skybox, SwapChain, Texture, TextureInternalFormat, TextureUsage, View,
+    Backend, Camera, Engine, EngineConfig, Entity, ImGuiHelper, IndirectLight, Ktx2Transcode,
+    LightDirtyMask, LightParams, Material,
+    MaterialInstance, MaterialOverrideSet, MaterialVariantMask, MaterialWarmup, ProgramCacheStats,
+    Renderer, Scene, Skybox, StagingRing, StagingRingStats, SwapChain, Texture,
+    TextureInternalFormat, TextureUsage, View,
 };
+use std::collections::HashMap;
 use std::ffi::c_void;
 use std::ffi::CString;
 use std::path::{Path, PathBuf};
+use std::time::{Duration, Instant};
 use winit::dpi::PhysicalSize;
 use winit::window::Window;
 
@@ -67,8 +76,9 @@ pub struct RenderContext {
     selected_entity: Option<Entity>,
     selected_outline_params: Option<([f32; 3], f32)>,
     selected_renderables: Vec<Entity>,
-    _selection_outline_material: Option<Material>,
+    selection_outline_material: Option<Material>,
     selection_outline_instance: Option<MaterialInstance>,
+    selection_outline_overrides: Option<MaterialOverrideSet>,
     selection_outline_last_applied_count: usize,
     selection_outline_unavailable_warned: bool,
     indirect_light: Option<IndirectLight>,
@@ -80,9 +90,17 @@ pub struct RenderContext {
     pick_system: Option<PickSystem>,
     pick_view: Option<View>,
     pending_pick_entities: Option<Vec<(PickKey, Vec<Entity>)>>,
+    // Part of the state key that decides whether the ID buffer is reused.
+    pick_scene: PickSceneState,
     editor_overlay: Option<editor_overlay::EditorOverlay>,
+    // Per-frame upload memory for dynamic geometry (gizmo line quads).
+    staging_ring: Option<StagingRing>,
     light_helpers: Option<light_helpers::LightHelperSystem>,
     light_helper_specs: Vec<LightHelperSpec>,
+    // Last parameters sent per light entity, so updates only touch changed fields.
+    light_params: HashMap<i32, LightParams>,
+    // Background program compilation queued after a scene load or import.
+    material_warmup: Option<(MaterialWarmup, Instant)>,
     viewport_width: u32,
     viewport_height: u32,
 }
@@ -92,22 +110,36 @@ const LAYER_OVERLAY: u8 = 0x02;
 const LAYER_PICK: u8 = 0x04;
 const LAYER_OUTLINE: u8 = 0x08;
 const OUTLINE_EXPAND_WORLD_DEFAULT: f32 = 0.02;
-
-struct SavedSelectionOutlineMaterials {
-    entity: Entity,
-    entries: Vec<(i32, *mut c_void)>,
-}
-
-struct SelectionOutlineRestore {
-    saved: Vec<SavedSelectionOutlineMaterials>,
-}
+const STAGING_RING_FRAMES: u32 = 3;
+const STAGING_RING_BYTES_PER_FRAME: usize = 256 * 1024;
 
 impl RenderContext {
-    pub fn new(window: &Window) -> Result<Self, RenderError> {
+    /// `program_cache_dir` enables the persistent program binary cache; it is
+    /// installed before any material is built.
+    pub fn new(
+        window: &Window,
+        engine_config: &EngineConfig,
+        program_cache_dir: Option<&Path>,
+    ) -> Result<Self, RenderError> {
         let native_handle = get_native_window_handle(window)?;
         let window_size = window.inner_size();
 
-        let mut engine = Engine::create(Backend::OpenGL).ok_or(RenderError::EngineCreateFailed)?;
+        let mut engine = Engine::create_with_config(Backend::OpenGL, engine_config)
+            .ok_or(RenderError::EngineCreateFailed)?;
+        log::info!("Engine config: {:?}", engine.config());
+        if let Some(dir) = program_cache_dir {
+            match std::fs::create_dir_all(dir) {
+                Ok(()) if engine.enable_program_cache(dir) => {
+                    log::info!("Program cache: {}", dir.display());
+                }
+                Ok(()) => log::warn!("Program cache unavailable for this platform."),
+                Err(err) => log::warn!(
+                    "Failed creating program cache folder '{}': {}",
+                    dir.display(),
+                    err
+                ),
+            }
+        }
         let swap_chain = engine
             .create_swap_chain(native_handle)
             .ok_or(RenderError::SwapChainCreateFailed)?;
@@ -201,6 +233,12 @@ impl RenderContext {
         } else {
             log::warn!("Selection outline material unavailable; GLTF selection outline disabled.");
         }
+        let selection_outline_overrides = engine.create_material_override_set();
+        let staging_ring =
+            engine.create_staging_ring(STAGING_RING_FRAMES, STAGING_RING_BYTES_PER_FRAME);
+        if staging_ring.is_none() {
+            log::warn!("Staging ring unavailable; dynamic geometry uploads will allocate per frame.");
+        }
 
         Ok(Self {
             engine,
@@ -218,8 +256,9 @@ impl RenderContext {
             selected_entity: None,
             selected_outline_params: None,
             selected_renderables: Vec::new(),
-            _selection_outline_material: selection_outline_material,
+            selection_outline_material,
             selection_outline_instance,
+            selection_outline_overrides,
             selection_outline_last_applied_count: 0,
             selection_outline_unavailable_warned: false,
             indirect_light: None,
@@ -230,14 +269,20 @@ impl RenderContext {
             pick_system,
             pick_view,
             pending_pick_entities: None,
+            pick_scene: PickSceneState::default(),
             editor_overlay,
+            staging_ring,
             light_helpers,
             light_helper_specs: Vec::new(),
+            light_params: HashMap::new(),
+            material_warmup: None,
             viewport_width: window_size.width.max(1),
             viewport_height: window_size.height.max(1),
         })
     }
 
+    /// Callers that add, remove or move renderables must call
+    /// `invalidate_pick_buffer`.
     pub fn engine_scene_mut(&mut self) -> (&mut Engine, &mut Scene) {
         (&mut self.engine, &mut self.scene)
     }
@@ -251,6 +296,7 @@ impl RenderContext {
         let height = new_size.height.max(1);
         self.viewport_width = width;
         self.viewport_height = height;
+        self.pick_scene.invalidate();
         self.view
             .set_viewport(0, 0, width, height);
         let aspect = width as f64 / height as f64;
@@ -312,6 +358,8 @@ impl RenderContext {
             .max(1)
             .min(window_height.saturating_sub(clamped_top));
         let bottom = window_height.saturating_sub(clamped_top + clamped_height);
+        self.pick_scene
+            .set_viewport([clamped_left, bottom, clamped_width, clamped_height]);
 
         self.view.set_viewport(
             clamped_left as i32,
@@ -588,11 +636,11 @@ impl RenderContext {
             if let Some(pickable) = self.pending_pick_entities.take() {
                 if let (Some(ps), Some(pv)) = (&mut self.pick_system, &self.pick_view) {
                     if let Some(overlay) = &mut self.editor_overlay {
-                        overlay.set_pick_width_mode(true);
+                        overlay.set_pick_width_mode(self.staging_ring.as_mut(), true);
                     }
-                    ps.render_pick_pass(&mut self.engine, &mut self.renderer, pv, &pickable);
+                    ps.render_pick_pass(&mut self.renderer, pv, &pickable);
                     if let Some(overlay) = &mut self.editor_overlay {
-                        overlay.set_pick_width_mode(false);
+                        overlay.set_pick_width_mode(self.staging_ring.as_mut(), false);
                     }
                 }
             }
@@ -611,15 +659,10 @@ impl RenderContext {
             }
             self.renderer.end_frame();
         }
-        // Pick readback — after endFrame, before next beginFrame
-        if let Some(ps) = &mut self.pick_system {
-            if ps.has_pending_pick() {
-                if ps.schedule_readback(&mut self.renderer) {
-                    self.engine.flush_and_wait();
-                    ps.complete_readback();
-                }
-            }
+        if let Some(ring) = &mut self.staging_ring {
+            ring.advance_frame();
         }
+        self.finish_pick_readbacks();
 
         let render_end = std::time::Instant::now();
         render_end
@@ -638,11 +681,11 @@ impl RenderContext {
             if let Some(pickable) = self.pending_pick_entities.take() {
                 if let (Some(ps), Some(pv)) = (&mut self.pick_system, &self.pick_view) {
                     if let Some(overlay) = &mut self.editor_overlay {
-                        overlay.set_pick_width_mode(true);
+                        overlay.set_pick_width_mode(self.staging_ring.as_mut(), true);
                     }
-                    ps.render_pick_pass(&mut self.engine, &mut self.renderer, pv, &pickable);
+                    ps.render_pick_pass(&mut self.renderer, pv, &pickable);
                     if let Some(overlay) = &mut self.editor_overlay {
-                        overlay.set_pick_width_mode(false);
+                        overlay.set_pick_width_mode(self.staging_ring.as_mut(), false);
                     }
                 }
             }
@@ -662,15 +705,10 @@ impl RenderContext {
             overlay_pass();
             self.renderer.end_frame();
         }
-        // Pick readback — after endFrame, before next beginFrame
-        if let Some(ps) = &mut self.pick_system {
-            if ps.has_pending_pick() {
-                if ps.schedule_readback(&mut self.renderer) {
-                    self.engine.flush_and_wait();
-                    ps.complete_readback();
-                }
-            }
+        if let Some(ring) = &mut self.staging_ring {
+            ring.advance_frame();
         }
+        self.finish_pick_readbacks();
 
         let render_end = std::time::Instant::now();
         render_end
@@ -679,8 +717,51 @@ impl RenderContext {
             * 1000.0
     }
 
+    /// Pick readback — after endFrame, before next beginFrame. Async click and
+    /// hover picks are issued here and decoded when a later frame's poll finds
+    /// them complete; in blocking mode click picks flush and decode immediately.
+    fn finish_pick_readbacks(&mut self) {
+        let Some(ps) = &mut self.pick_system else {
+            return;
+        };
+        if ps.async_readback() {
+            ps.schedule_async_click_readback(&mut self.renderer);
+        } else if ps.has_pending_pick() {
+            if ps.schedule_readback(&mut self.renderer) {
+                self.engine.flush_and_wait();
+                ps.complete_readback();
+            } else if ps.awaiting_view_pick() {
+                // No ID readback this frame, but the click still needs the
+                // View::pick result from the frame that was just submitted.
+                self.engine.flush_and_wait();
+            }
+        }
+        ps.schedule_async_readback(&mut self.renderer);
+        ps.schedule_region_readback(&mut self.renderer);
+        self.engine.pump_message_queues();
+        ps.poll_async_readbacks();
+        ps.poll_view_pick();
+        ps.poll_region_pick();
+    }
+
     pub fn set_light(&mut self, entity: Entity, params: LightParams) {
-        self.engine.set_light(entity, params);
+        self.set_lights(&[(entity, params)]);
+    }
+
+    /// Update several lights in one batch. Only fields that changed since the
+    /// last update of each light are applied; unchanged lights cost nothing.
+    pub fn set_lights(&mut self, lights: &[(Entity, LightParams)]) {
+        let mut updates = Vec::with_capacity(lights.len());
+        for &(entity, params) in lights {
+            let mask = match self.light_params.insert(entity.id, params) {
+                Some(previous) => params.dirty_mask(&previous),
+                None => LightDirtyMask::ALL,
+            };
+            if !mask.is_empty() {
+                updates.push((entity, params, mask));
+            }
+        }
+        self.engine.update_lights(&updates);
     }
 
     pub fn set_selected_entity(&mut self, entity: Option<Entity>) {
@@ -712,12 +793,15 @@ impl RenderContext {
         }
     }
 
-    pub fn set_entity_transform(&mut self, entity: Entity, matrix4x4: [f32; 16]) -> bool {
+    pub fn set_entity_transforms(&mut self, transforms: &[(Entity, [f32; 16])]) -> bool {
         let Some(mut tm) = self.engine.transform_manager() else {
-            log::warn!("Transform manager unavailable; skipping entity transform update.");
+            log::warn!("Transform manager unavailable; skipping batched transform update.");
             return false;
         };
-        tm.set_transform(entity, &matrix4x4);
+        tm.set_transforms(transforms);
+        if !transforms.is_empty() {
+            self.pick_scene.invalidate();
+        }
         true
     }
 
@@ -742,6 +826,55 @@ impl RenderContext {
         true
     }
 
+    /// Bind a KTX texture read ahead of time; see `bind_material_texture_from_ktx`.
+    pub fn bind_material_texture_from_ktx_bytes(
+        &mut self,
+        material_instance: &mut MaterialInstance,
+        texture_param: &str,
+        ktx_bytes: &[u8],
+        wrap_repeat_u: bool,
+        wrap_repeat_v: bool,
+    ) -> bool {
+        let Some(texture) = self.engine.bind_material_texture_from_ktx_bytes(
+            material_instance,
+            texture_param,
+            ktx_bytes,
+            wrap_repeat_u,
+            wrap_repeat_v,
+        ) else {
+            return false;
+        };
+        self.material_textures.push(texture);
+        true
+    }
+
+    /// See `Engine::begin_ktx2_transcode`.
+    pub fn begin_ktx2_transcode(&mut self, ktx2_bytes: &[u8]) -> Option<Ktx2Transcode> {
+        self.engine.begin_ktx2_transcode(ktx2_bytes)
+    }
+
+    /// Bind a KTX2 texture transcoded on the load pool.
+    pub fn bind_material_texture_from_ktx2_transcode(
+        &mut self,
+        material_instance: &mut MaterialInstance,
+        texture_param: &str,
+        transcode: &mut Ktx2Transcode,
+        wrap_repeat_u: bool,
+        wrap_repeat_v: bool,
+    ) -> bool {
+        let Some(texture) = self.engine.bind_material_texture_from_ktx2_transcode(
+            material_instance,
+            texture_param,
+            transcode,
+            wrap_repeat_u,
+            wrap_repeat_v,
+        ) else {
+            return false;
+        };
+        self.material_textures.push(texture);
+        true
+    }
+
     pub fn set_environment(&mut self, ibl_path: &str, skybox_path: &str, intensity: f32) -> bool {
         if ibl_path.is_empty() && skybox_path.is_empty() {
             return false;
@@ -781,61 +914,103 @@ impl RenderContext {
         true
     }
 
+    /// Remove the indirect light and skybox.
+    pub fn clear_environment(&mut self) {
+        self.scene.set_indirect_light(None);
+        self.scene.set_skybox(None);
+        self.indirect_light = None;
+        self.indirect_light_texture = None;
+        self.skybox = None;
+        self.skybox_texture = None;
+    }
+
     pub fn set_environment_intensity(&mut self, intensity: f32) {
         if let Some(light) = &mut self.indirect_light {
             light.set_intensity(intensity);
         }
     }
 
-    pub fn clear_scene(&mut self) {
-        if let Some(light_helpers) = &mut self.light_helpers {
-            light_helpers.clear(&mut self.engine, &mut self.scene);
-        }
-        self.light_helper_specs.clear();
+    /// Re-render the ID pass on the next pick, after renderables were added,
+    /// removed or moved.
+    pub fn invalidate_pick_buffer(&mut self) {
+        self.pick_scene.invalidate();
+    }
 
-        // Remove all entities from the Filament scene except camera
-        // Note: In a full implementation, we'd track all entities and remove them properly
-        // For now, we create a fresh scene
-        if let Some(new_scene) = self.engine.create_scene() {
-            self.scene = new_scene;
-        } else {
-            log::error!(
-                "Failed to create replacement scene during clear_scene; keeping existing scene."
-            );
-            return;
-        }
-        self.view.set_scene(&mut self.scene);
-        if let Some(overlay_view) = &mut self.overlay_view {
-            overlay_view.set_scene(&mut self.scene);
-        }
-        if let Some(pick_view) = &mut self.pick_view {
-            pick_view.set_scene(&mut self.scene);
-        }
+    /// Forget picks and selection state that refer to scene objects by index,
+    /// after objects were added to or removed from the scene.
+    pub fn invalidate_scene_picks(&mut self) {
         self.pending_pick_entities = None;
+        self.pick_scene.invalidate();
         self.selected_entity = None;
         self.selected_outline_params = None;
         self.selected_renderables.clear();
         if let Some(ps) = &mut self.pick_system {
             ps.reset_scene_state();
         }
-        if let Some(overlay) = &self.editor_overlay {
-            overlay.attach_to_scene(&mut self.scene);
-        }
-
-        // Reset environment
-        self.scene.set_indirect_light(None);
-        self.scene.set_skybox(None);
-        self.indirect_light = None;
-        self.indirect_light_texture = None;
-        self.skybox = None;
-        self.skybox_texture = None;
+    }
 
+    /// Remove a light created with `Engine::create_light` and destroy it.
+    pub fn destroy_light(&mut self, entity: Entity) {
+        self.scene.remove_entity(entity);
+        self.engine.destroy_entity(entity);
+        self.light_params.remove(&entity.id);
     }
 
     pub fn flush_and_wait(&mut self) {
         self.engine.flush_and_wait();
     }
 
+    // ====================================================================
+    // Material warm-up
+    // ====================================================================
+
+    /// Queue background compilation of the programs the scene's
+    /// `material_instances` draw with (lit and shadow-receiving variants),
+    /// plus the pick ID and selection outline materials, so the first frames
+    /// after a load do not compile them inline. Replaces any warm-up already
+    /// in flight. Returns the number of distinct materials queued.
+    pub fn begin_material_warmup(&mut self, material_instances: &[MaterialInstance]) -> u32 {
+        let Some(mut warmup) = MaterialWarmup::new() else {
+            return 0;
+        };
+        let scene_variants = MaterialVariantMask::LIT.union(MaterialVariantMask::SHADOWED);
+        for instance in material_instances {
+            warmup.add_instance(instance, scene_variants);
+        }
+        if let Some(pick_system) = &self.pick_system {
+            warmup.add(pick_system.material(), MaterialVariantMask::BASE);
+        }
+        if let Some(material) = &self.selection_outline_material {
+            warmup.add(material, MaterialVariantMask::BASE);
+        }
+        self.engine.flush();
+        let count = warmup.count();
+        self.material_warmup = Some((warmup, Instant::now()));
+        count
+    }
+
+    /// `(compiled, total)` materials of the warm-up in flight, if any.
+    pub fn material_warmup_progress(&self) -> Option<(u32, u32)> {
+        self.material_warmup.as_ref().map(|(warmup, _)| {
+            let total = warmup.count();
+            (total - warmup.pending().min(total), total)
+        })
+    }
+
+    /// Retire a finished warm-up, returning its material count and duration.
+    pub fn poll_material_warmup(&mut self) -> Option<(u32, Duration)> {
+        let (warmup, started) = self.material_warmup.as_ref()?;
+        if warmup.pending() > 0 {
+            self.engine.pump_message_queues();
+            if warmup.pending() > 0 {
+                return None;
+            }
+        }
+        let result = (warmup.count(), started.elapsed());
+        self.material_warmup = None;
+        Some(result)
+    }
+
     // ====================================================================
     // GPU Pick Pass public API
     // ====================================================================
@@ -856,7 +1031,7 @@ impl RenderContext {
         let has_pending = self
             .pick_system
             .as_ref()
-            .map_or(false, |ps| ps.has_pending_pick());
+            .map_or(false, |ps| ps.wants_pick_pass());
         if !has_pending {
             return;
         }
@@ -868,7 +1043,62 @@ impl RenderContext {
             // Keep gizmo handles last so they win pick priority over helper geometry.
             merged.extend(overlay.pickable_entities());
         }
-        self.pending_pick_entities = Some(merged);
+        if let Some(ps) = &mut self.pick_system {
+            if ps.backend() == PickBackend::ViewPick {
+                // Scene meshes resolve through View::pick on the beauty view; only
+                // overlay handles need the ID pass. If the query cannot be issued,
+                // keep the meshes in the ID pass so the click still resolves.
+                // Region picks always read scene meshes from the ID pass.
+                let has_scene_keys = merged
+                    .iter()
+                    .any(|(key, _)| key.kind == PickKind::SceneMesh);
+                let view_pick_issued = ps.has_pending_pick()
+                    && has_scene_keys
+                    && ps.issue_view_pick(&self.view, &merged);
+                if !ps.has_pending_region() && (view_pick_issued || !ps.has_pending_pick()) {
+                    merged.retain(|(key, _)| key.kind != PickKind::SceneMesh);
+                }
+                if merged.is_empty() {
+                    ps.skip_id_pass();
+                    self.pending_pick_entities = None;
+                    return;
+                }
+            }
+        }
+        let state_key = self.pick_scene.key(
+            &self.camera.view_projection_matrix(),
+            (self.viewport_width, self.viewport_height),
+            &merged,
+        );
+        let needs_render = self
+            .pick_system
+            .as_mut()
+            .map_or(false, |ps| ps.prepare_id_pass(state_key));
+        // When the ID target already holds this state, lookups read it back
+        // without drawing the pick pass again.
+        self.pending_pick_entities = needs_render.then_some(merged);
+    }
+
+    /// Request a hover pick. Returns `true` when the result will arrive through
+    /// `take_hover_pick_hit` on a later frame, `false` when it was queued as a
+    /// regular pick and will arrive through `take_pick_hit`.
+    pub fn request_hover_pick(&mut self, screen_x: f32, screen_y: f32) -> bool {
+        self.pick_system
+            .as_mut()
+            .map_or(false, |ps| ps.request_hover_pick(screen_x, screen_y))
+    }
+
+    /// Request a rectangle pick between two screen corners (top-left origin).
+    /// The coverage result arrives through `take_region_pick_hit` a few frames later.
+    pub fn request_region_pick(&mut self, x0: f32, y0: f32, x1: f32, y1: f32) {
+        if let Some(ps) = &mut self.pick_system {
+            ps.request_region_pick(x0, y0, x1, y1);
+        }
+    }
+
+    /// Take the latest decoded region pick, if one completed.
+    pub fn take_region_pick_hit(&mut self) -> Option<PickRegionHit> {
+        self.pick_system.as_mut().and_then(|ps| ps.take_region_hit())
     }
 
     /// Take the latest pick result, if available.
@@ -876,18 +1106,60 @@ impl RenderContext {
         self.pick_system.as_mut().and_then(|ps| ps.take_hit())
     }
 
+    /// Take the latest async hover pick result, if one completed.
+    pub fn take_hover_pick_hit(&mut self) -> Option<PickHit> {
+        self.pick_system.as_mut().and_then(|ps| ps.take_hover_hit())
+    }
+
+    pub fn set_pick_backend(&mut self, backend: PickBackend) {
+        if let Some(ps) = &mut self.pick_system {
+            ps.set_backend(backend);
+        }
+    }
+
+    pub fn set_pick_readback_mode(&mut self, mode: PickReadbackMode) {
+        if let Some(ps) = &mut self.pick_system {
+            ps.set_readback_mode(mode);
+        }
+    }
+
     /// Whether GPU picking is available.
     pub fn has_pick_system(&self) -> bool {
         self.pick_system.is_some()
     }
 
+    /// ID pass render/reuse counters.
+    pub fn pick_stats(&self) -> Option<PickStats> {
+        self.pick_system.as_ref().map(|ps| ps.stats())
+    }
+
+    /// Engine::Config the engine is running with, after Filament's validation.
+    pub fn engine_config(&self) -> EngineConfig {
+        self.engine.config()
+    }
+
+    pub fn program_cache_stats(&self) -> ProgramCacheStats {
+        self.engine.program_cache_stats()
+    }
+
+    /// Upload counters for the dynamic geometry staging ring.
+    pub fn staging_ring_stats(&self) -> Option<StagingRingStats> {
+        self.staging_ring.as_ref().map(|ring| ring.stats())
+    }
+
     pub fn update_gizmo_overlay(&mut self, params: GizmoParams) {
         if let Some(overlay) = &mut self.editor_overlay {
-            overlay.set_params(&mut self.engine, params);
+            if *overlay.params() != params {
+                self.pick_scene.invalidate();
+            }
+            overlay.set_params(&mut self.engine, self.staging_ring.as_mut(), params);
         }
     }
 
     pub fn sync_light_helpers(&mut self, specs: &[LightHelperSpec], camera_position: [f32; 3]) {
+        if self.light_helper_specs.as_slice() != specs {
+            self.pick_scene.invalidate();
+        }
         self.light_helper_specs.clear();
         self.light_helper_specs.extend_from_slice(specs);
         let Some(system) = &mut self.light_helpers else {
@@ -1040,8 +1312,8 @@ impl RenderContext {
         .map_err(|err| format!("failed writing screenshot '{}': {}", path.display(), err))
     }
 
-    fn begin_selection_outline_pass(&mut self) -> Option<SelectionOutlineRestore> {
-        if self.selection_outline_instance.is_none() {
+    fn begin_selection_outline_pass(&mut self) -> bool {
+        if self.selection_outline_instance.is_none() || self.selection_outline_overrides.is_none() {
             if !self.selected_renderables.is_empty() && !self.selection_outline_unavailable_warned {
                 log::warn!(
                     "Outline requested for {} renderables, but outline material instance is unavailable.",
@@ -1049,14 +1321,14 @@ impl RenderContext {
                 );
                 self.selection_outline_unavailable_warned = true;
             }
-            return None;
+            return false;
         }
         self.selection_outline_unavailable_warned = false;
         if self.selected_renderables.is_empty() {
             if self.selection_outline_last_applied_count != 0 {
                 self.selection_outline_last_applied_count = 0;
             }
-            return None;
+            return false;
         }
 
         if let Some(outline) = self.selection_outline_instance.as_mut() {
@@ -1066,66 +1338,45 @@ impl RenderContext {
             outline.set_float3("center", center);
             outline.set_float("expand", expand.max(0.0001));
         }
-        let Some(outline) = self.selection_outline_instance.as_ref() else {
-            return None;
+        let (Some(outline), Some(overrides)) = (
+            self.selection_outline_instance.as_ref(),
+            self.selection_outline_overrides.as_mut(),
+        ) else {
+            return false;
         };
 
-        let mut saved = Vec::new();
-        for &entity in &self.selected_renderables {
-            let primitive_count = self.engine.renderable_primitive_count(entity);
-            if primitive_count <= 0 {
-                continue;
-            }
-            let mut entries = Vec::with_capacity(primitive_count as usize);
-            for primitive_index in 0..primitive_count {
-                let original = self
-                    .engine
-                    .renderable_get_material_raw(entity, primitive_index);
-                entries.push((primitive_index, original));
-                self.engine
-                    .renderable_set_material(entity, primitive_index, outline);
-            }
-            self.engine
-                .renderable_set_layer_mask(entity, 0xFF, LAYER_OUTLINE);
-            saved.push(SavedSelectionOutlineMaterials { entity, entries });
-        }
+        let entries: Vec<(Entity, &MaterialInstance, u8)> = self
+            .selected_renderables
+            .iter()
+            .map(|&entity| (entity, outline, LAYER_OUTLINE))
+            .collect();
+        let primitive_count = overrides.push(&entries);
 
-        if saved.is_empty() {
+        if primitive_count <= 0 {
+            overrides.pop();
             log::warn!(
                 "Outline pass found selected renderables but no renderable primitives were available."
             );
-            return None;
+            return false;
         }
-        if self.selection_outline_last_applied_count != saved.len() {
-            self.selection_outline_last_applied_count = saved.len();
+        if self.selection_outline_last_applied_count != primitive_count as usize {
+            self.selection_outline_last_applied_count = primitive_count as usize;
             log::info!(
-                "Outline pass applied to {} renderable entities.",
+                "Outline pass applied to {} renderable primitives.",
                 self.selection_outline_last_applied_count
             );
         }
-        Some(SelectionOutlineRestore { saved })
+        true
     }
 
-    fn end_selection_outline_pass(&mut self, state: Option<SelectionOutlineRestore>) {
-        let Some(state) = state else {
-            return;
-        };
-        for saved_entity in state.saved {
-            for (primitive_index, material_ptr) in saved_entity.entries {
-                self.engine.renderable_restore_material_raw(
-                    saved_entity.entity,
-                    primitive_index,
-                    material_ptr,
-                );
-            }
-            self.engine
-                .renderable_set_layer_mask(saved_entity.entity, 0xFF, LAYER_SCENE);
+    fn end_selection_outline_pass(&mut self) {
+        if let Some(overrides) = self.selection_outline_overrides.as_mut() {
+            overrides.pop();
         }
     }
 
     fn render_selection_outline_pass(&mut self) {
-        let state = self.begin_selection_outline_pass();
-        if state.is_none() {
+        if !self.begin_selection_outline_pass() {
             return;
         }
         // Keep beauty pass depth/color so the outline shell can test against it.
@@ -1136,7 +1387,7 @@ impl RenderContext {
         self.view.set_visible_layers(0xFF, LAYER_SCENE);
         self.renderer
             .set_clear_options(0.1, 0.1, 0.2, 1.0, true, false);
-        self.end_selection_outline_pass(state);
+        self.end_selection_outline_pass();
     }
 }
 
@@ -9,16 +9,47 @@
 //! The pick pass shares the main scene's entities but temporarily swaps
 //! their materials to a flat unlit pick material before rendering. After
 //! the pick pass, original materials are restored. This avoids duplicating
-//! geometry while keeping the pick pass isolated.
+//! geometry while keeping the pick pass isolated. The swap and restore are
+//! each a single batched call into a C++ `MaterialOverrideSet`.
+//!
+//! ## Readback
+//!
+//! Click picks are read back with a flush so the result is available the same
+//! frame. Hover picks can instead use `PickReadbackMode::Async`: a small ring of
+//! `AsyncReadback` slots is filled by the GPU and polled on later frames, so
+//! continuous hover picking never blocks the main thread.
+//!
+//! ## Backends
+//!
+//! With `PickBackend::ViewPick`, click picks resolve scene meshes through
+//! Filament's `View::pick` query on the beauty view (renderable + depth from
+//! the structure buffer) and only overlay handles go through the ID pass. When
+//! no overlay handles are pickable, the ID pass is skipped entirely.
+//!
+//! ## Persistent ID buffer
+//!
+//! The ID target stays valid across frames. Callers pass a state key covering
+//! the camera, transforms, visibility and pickable set to `prepare_id_pass`;
+//! the pass is re-rendered only when the key changes, and every hover or click
+//! lookup in between reads back from the same buffer.
+//!
+//! ## Region picks
+//!
+//! `request_region_pick` reads back an arbitrary rectangle of the ID target in
+//! one async readback. A worker thread decodes the pixels into a `PickRegionHit`
+//! listing every staged key in the rectangle with its pixel coverage, for
+//! marquee selection and "what is under this area" queries.
 
 #![allow(dead_code)]
 
 use crate::filament::{
-    Engine, Entity, Material, MaterialInstance, RenderTarget, Renderer,
-    Texture, TextureInternalFormat, TextureUsage, View,
+    AsyncReadback, Engine, Entity, Material, MaterialInstance, MaterialOverrideSet, RenderTarget,
+    Renderer, Texture, TextureInternalFormat, TextureUsage, View, ViewPickQuery, ViewPickResult,
 };
+use std::collections::hash_map::DefaultHasher;
 use std::collections::{HashMap, HashSet};
-use std::ffi::c_void;
+use std::hash::{Hash, Hasher};
+use std::thread::JoinHandle;
 
 // ========================================================================
 // PickKey — 32-bit packed identifier for any pickable element
@@ -132,6 +163,10 @@ pub struct PickHit {
     pub key: PickKey,
     pub screen_x: f32,
     pub screen_y: f32,
+    /// Depth buffer value at the hit (reversed-Z), for `View::pick` hits.
+    pub depth: Option<f32>,
+    /// World-space position of the picked fragment, for `View::pick` hits.
+    pub world_position: Option<[f32; 3]>,
 }
 
 impl PickHit {
@@ -140,6 +175,8 @@ impl PickHit {
             key: PickKey::NONE,
             screen_x: 0.0,
             screen_y: 0.0,
+            depth: None,
+            world_position: None,
         }
     }
 
@@ -148,18 +185,248 @@ impl PickHit {
     }
 }
 
-// ========================================================================
-// per-entity saved material state for swap/restore
-// ========================================================================
+/// Result of a rectangle pick: every staged key inside the rectangle with the
+/// number of pixels it covers, largest coverage first.
+#[derive(Debug, Clone, Default)]
+pub struct PickRegionHit {
+    /// Rectangle corners in screen coordinates (top-left origin).
+    pub screen_min: (f32, f32),
+    pub screen_max: (f32, f32),
+    /// Pixels read back, including those not covered by any key.
+    pub pixel_count: u32,
+    pub coverage: Vec<(PickKey, u32)>,
+}
 
-struct SavedMaterials {
-    /// (primitive_index, raw_material_instance_pointer)
-    entries: Vec<(i32, *mut c_void)>,
+impl PickRegionHit {
+    pub fn is_empty(&self) -> bool {
+        self.coverage.is_empty()
+    }
+
+    /// Key covering the most pixels among those accepted by `filter`.
+    pub fn dominant_key(&self, filter: impl Fn(&PickKey) -> bool) -> Option<PickKey> {
+        self.coverage
+            .iter()
+            .find(|(key, _)| filter(key))
+            .map(|(key, _)| *key)
+    }
 }
 
-const LAYER_SCENE: u8 = 0x01;
-const LAYER_OVERLAY: u8 = 0x02;
 const LAYER_PICK: u8 = 0x04;
+const ASYNC_READBACK_SLOTS: usize = 3;
+// Frames to wait for a `View::pick` result before resolving the click without it.
+const VIEW_PICK_MAX_WAIT_FRAMES: u32 = 4;
+
+/// How click picks resolve scene meshes.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum PickBackend {
+    /// Render every pickable into the ID target with per-key pick materials.
+    IdPass,
+    /// Query the beauty view with `View::pick` for scene meshes; only overlay
+    /// handles use the ID pass.
+    ViewPick,
+}
+
+impl PickBackend {
+    pub fn from_str(value: &str) -> Option<Self> {
+        match value.trim().to_ascii_lowercase().as_str() {
+            "id" | "id-pass" => Some(Self::IdPass),
+            "view" | "view-pick" => Some(Self::ViewPick),
+            _ => None,
+        }
+    }
+
+    pub fn as_str(self) -> &'static str {
+        match self {
+            Self::IdPass => "id-pass",
+            Self::ViewPick => "view-pick",
+        }
+    }
+}
+
+/// Counters for how often the ID pass was rendered versus reused.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct PickStats {
+    pub id_pass_renders: u64,
+    pub id_pass_reuses: u64,
+}
+
+/// Pick-visible scene state that the camera and pickable set do not capture.
+/// The generation only moves when renderables are added, removed or moved, or
+/// the scene viewport changes, so idle frames keep reusing the ID buffer.
+#[derive(Debug, Default)]
+pub struct PickSceneState {
+    generation: u64,
+    viewport: Option<[u32; 4]>,
+}
+
+impl PickSceneState {
+    /// The ID buffer no longer matches the scene.
+    pub fn invalidate(&mut self) {
+        self.generation += 1;
+    }
+
+    /// Record the scene viewport rect, invalidating only when it changed.
+    pub fn set_viewport(&mut self, viewport: [u32; 4]) {
+        if self.viewport != Some(viewport) {
+            self.viewport = Some(viewport);
+            self.invalidate();
+        }
+    }
+
+    /// Hash of everything the ID pass output depends on: scene generation,
+    /// camera view-projection, target size and the pickable set.
+    pub fn key(
+        &self,
+        view_projection: &[f64; 16],
+        target_size: (u32, u32),
+        pickables: &[(PickKey, Vec<Entity>)],
+    ) -> u64 {
+        let mut hasher = DefaultHasher::new();
+        self.generation.hash(&mut hasher);
+        for value in view_projection {
+            value.to_bits().hash(&mut hasher);
+        }
+        target_size.hash(&mut hasher);
+        for (key, entities) in pickables {
+            key.hash(&mut hasher);
+            entities.len().hash(&mut hasher);
+            for entity in entities {
+                entity.id.hash(&mut hasher);
+            }
+        }
+        hasher.finish()
+    }
+}
+
+/// Click pick waiting on its `View::pick` result.
+struct PendingViewPick {
+    screen: (f32, f32),
+    epoch: u64,
+    // ID-pass result for overlay handles; set once that readback resolves.
+    overlay_hit: Option<PickHit>,
+    frames_waited: u32,
+}
+
+/// A `View::pick` result slot; implemented by `ViewPickQuery`.
+trait PickQuery {
+    fn is_busy(&self) -> bool;
+    fn poll(&mut self) -> Option<ViewPickResult>;
+}
+
+impl PickQuery for ViewPickQuery {
+    fn is_busy(&self) -> bool {
+        ViewPickQuery::is_busy(self)
+    }
+
+    fn poll(&mut self) -> Option<ViewPickResult> {
+        ViewPickQuery::poll(self)
+    }
+}
+
+/// The view pick query plus whether it still carries an abandoned click
+/// (timed out or reset). An abandoned query stays in flight until Filament
+/// calls back; its result is drained and dropped before the slot is reused.
+struct ViewPickSlot<Q> {
+    query: Q,
+    abandoned: bool,
+}
+
+impl<Q: PickQuery> ViewPickSlot<Q> {
+    fn new(query: Q) -> Self {
+        Self {
+            query,
+            abandoned: false,
+        }
+    }
+
+    /// Give up on the query in flight without losing track of it.
+    fn abandon(&mut self) {
+        self.abandoned = self.query.is_busy();
+    }
+
+    /// Drop the abandoned result if it has arrived. Returns `true` once the
+    /// slot holds no abandoned work.
+    fn drain(&mut self) -> bool {
+        if self.abandoned {
+            self.query.poll();
+            self.abandoned = self.query.is_busy();
+        }
+        !self.abandoned
+    }
+
+    /// The query, for issuing a new pick, once any abandoned one has drained.
+    fn query_for_issue(&mut self) -> Option<&mut Q> {
+        if self.drain() {
+            Some(&mut self.query)
+        } else {
+            None
+        }
+    }
+
+    /// Result of the current (not abandoned) query.
+    fn poll(&mut self) -> Option<ViewPickResult> {
+        if self.drain() {
+            self.query.poll()
+        } else {
+            None
+        }
+    }
+}
+
+/// How click and hover picks are read back from the pick target.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum PickReadbackMode {
+    /// Flush and wait after the pick pass; the result is ready the same frame.
+    Blocking,
+    /// Keep up to `ASYNC_READBACK_SLOTS` readbacks in flight and poll them on
+    /// later frames. At most one of them is a click.
+    Async,
+}
+
+impl PickReadbackMode {
+    pub fn from_str(value: &str) -> Option<Self> {
+        match value.trim().to_ascii_lowercase().as_str() {
+            "blocking" | "sync" => Some(Self::Blocking),
+            "async" => Some(Self::Async),
+            _ => None,
+        }
+    }
+
+    pub fn as_str(self) -> &'static str {
+        match self {
+            Self::Blocking => "blocking",
+            Self::Async => "async",
+        }
+    }
+}
+
+/// One in-flight click or hover readback and the state needed to decode it.
+struct AsyncPickSlot {
+    readback: AsyncReadback,
+    screen: (f32, f32),
+    // Click results resolve through `last_hit`, hover results through `last_hover_hit`.
+    click: bool,
+    // Scene epoch at submission; results from before a reset/resize are dropped.
+    epoch: u64,
+    sequence: u64,
+    // Pick keys staged for the pass this readback was taken from.
+    valid_keys: HashSet<u32>,
+}
+
+/// Region readback waiting on the GPU.
+struct RegionReadback {
+    screen_min: (f32, f32),
+    screen_max: (f32, f32),
+    epoch: u64,
+    byte_len: usize,
+    valid_keys: HashSet<u32>,
+}
+
+/// Region pixels being decoded on a worker thread.
+struct RegionDecode {
+    epoch: u64,
+    handle: JoinHandle<PickRegionHit>,
+}
 
 // ========================================================================
 // PickSystem — manages the offscreen pick pass
@@ -176,6 +443,8 @@ pub struct PickSystem {
 
     // Per-pick-key material instances keyed by RGBA packing.
     pick_instances: HashMap<u32, MaterialInstance>,
+    // Saved scene materials/layers while the pick pass is rendering.
+    material_overrides: MaterialOverrideSet,
 
     // Viewport size (for coordinate transform and resize)
     width: u32,
@@ -193,6 +462,38 @@ pub struct PickSystem {
     pending_readback: Option<(f32, f32, u32, u32)>,
     // Valid packed pick keys staged for the latest pick pass.
     staged_keys: HashSet<u32>,
+
+    // Async hover readback state
+    readback_mode: PickReadbackMode,
+    pending_hover: Option<(f32, f32)>,
+    last_hover_hit: Option<PickHit>,
+    async_slots: Vec<AsyncPickSlot>,
+    scene_epoch: u64,
+    next_hover_sequence: u64,
+    latest_hover_sequence: u64,
+
+    // View::pick backend state
+    backend: PickBackend,
+    view_pick_query: Option<ViewPickSlot<ViewPickQuery>>,
+    pending_view_pick: Option<PendingViewPick>,
+    // Renderable entity id -> scene pick key for the pending view pick.
+    view_pick_keys: HashMap<i32, PickKey>,
+
+    // Region pick state. One region is read back and decoded at a time.
+    pending_region: Option<((f32, f32), (f32, f32))>,
+    region_readback: Option<AsyncReadback>,
+    region_readback_capacity: u32,
+    region_pixels: Vec<u8>,
+    region_in_flight: Option<RegionReadback>,
+    region_decode: Option<RegionDecode>,
+    last_region_hit: Option<PickRegionHit>,
+
+    // State key of the pass currently in the ID target, and the key the
+    // latest lookups were made against. The buffer answers lookups only while
+    // the two match.
+    id_buffer_key: Option<u64>,
+    requested_state_key: Option<u64>,
+    stats: PickStats,
 }
 
 impl PickSystem {
@@ -217,6 +518,22 @@ impl PickSystem {
         // Load pick material from compiled package
         let pick_material_bytes = include_bytes!(concat!(env!("OUT_DIR"), "/pickId.filamat"));
         let pick_material = engine.create_material(pick_material_bytes)?;
+        let material_overrides = engine.create_material_override_set()?;
+        let async_slots: Vec<AsyncPickSlot> = (0..ASYNC_READBACK_SLOTS)
+            .filter_map(|_| {
+                AsyncReadback::new(4).map(|readback| AsyncPickSlot {
+                    readback,
+                    screen: (0.0, 0.0),
+                    click: false,
+                    epoch: 0,
+                    sequence: 0,
+                    valid_keys: HashSet::new(),
+                })
+            })
+            .collect();
+        if async_slots.is_empty() {
+            log::warn!("Async pick readback unavailable; picks will block.");
+        }
 
         log::info!("PickSystem initialized ({}×{})", w, h);
 
@@ -226,6 +543,7 @@ impl PickSystem {
             render_target,
             pick_material,
             pick_instances: HashMap::new(),
+            material_overrides,
             width: w,
             height: h,
             readback_buffer: vec![0u8; 4], // 1×1 RGBA
@@ -233,6 +551,27 @@ impl PickSystem {
             last_hit: None,
             pending_readback: None,
             staged_keys: HashSet::new(),
+            readback_mode: PickReadbackMode::Blocking,
+            pending_hover: None,
+            last_hover_hit: None,
+            async_slots,
+            scene_epoch: 0,
+            next_hover_sequence: 1,
+            latest_hover_sequence: 0,
+            backend: PickBackend::IdPass,
+            view_pick_query: ViewPickQuery::new().map(ViewPickSlot::new),
+            pending_view_pick: None,
+            view_pick_keys: HashMap::new(),
+            pending_region: None,
+            region_readback: None,
+            region_readback_capacity: 0,
+            region_pixels: Vec::new(),
+            region_in_flight: None,
+            region_decode: None,
+            last_region_hit: None,
+            id_buffer_key: None,
+            requested_state_key: None,
+            stats: PickStats::default(),
         })
     }
 
@@ -277,6 +616,9 @@ impl PickSystem {
         self.render_target = rt;
         self.width = w;
         self.height = h;
+        // In-flight hover readbacks refer to the old target's coordinates.
+        self.scene_epoch += 1;
+        self.id_buffer_key = None;
 
         log::info!("PickSystem resized to {}×{}", w, h);
         true
@@ -288,9 +630,74 @@ impl PickSystem {
         self.pending_pick = Some((screen_x, screen_y));
     }
 
-    /// Check if there is a pending pick request.
+    /// Check if there is a pending pick request that can be read back this
+    /// frame. With async readback a click waits while an earlier one is still
+    /// in flight.
     pub fn has_pending_pick(&self) -> bool {
-        self.pending_pick.is_some()
+        self.pending_pick.is_some() && (!self.async_readback() || self.click_slot_ready())
+    }
+
+    /// Whether picks are read back through the async slots instead of a flush.
+    pub fn async_readback(&self) -> bool {
+        self.readback_mode == PickReadbackMode::Async && !self.async_slots.is_empty()
+    }
+
+    pub fn set_readback_mode(&mut self, mode: PickReadbackMode) {
+        self.readback_mode = mode;
+        if mode == PickReadbackMode::Blocking {
+            if let Some((x, y)) = self.pending_hover.take() {
+                self.pending_pick.get_or_insert((x, y));
+            }
+        }
+    }
+
+    pub fn readback_mode(&self) -> PickReadbackMode {
+        self.readback_mode
+    }
+
+    /// Request a hover pick. Returns `true` when it will be read back
+    /// asynchronously (result via `take_hover_hit`), `false` when it was queued
+    /// as a regular blocking pick (result via `take_hit`).
+    pub fn request_hover_pick(&mut self, screen_x: f32, screen_y: f32) -> bool {
+        if self.async_readback() {
+            self.pending_hover = Some((screen_x, screen_y));
+            true
+        } else {
+            self.request_pick(screen_x, screen_y);
+            false
+        }
+    }
+
+    /// Whether the next frame needs a pick pass: a click pick is ready, or a
+    /// hover pick is pending and a readback slot is free to receive it.
+    pub fn wants_pick_pass(&self) -> bool {
+        self.has_pending_pick()
+            || (self.pending_hover.is_some() && self.free_async_slot().is_some())
+            || (self.pending_region.is_some() && self.region_idle())
+    }
+
+    /// Request a rectangle pick between two screen corners (top-left origin, any
+    /// order). Replaces a region request that has not been read back yet; the
+    /// result arrives through `take_region_hit` a few frames later.
+    pub fn request_region_pick(&mut self, x0: f32, y0: f32, x1: f32, y1: f32) {
+        let min = (x0.min(x1).max(0.0), y0.min(y1).max(0.0));
+        let max = (x0.max(x1).max(0.0), y0.max(y1).max(0.0));
+        self.pending_region = Some((min, max));
+    }
+
+    /// Whether a region pick still needs the ID pass.
+    pub fn has_pending_region(&self) -> bool {
+        self.pending_region.is_some()
+    }
+
+    /// Take the latest decoded region pick (if any). Consumes it.
+    pub fn take_region_hit(&mut self) -> Option<PickRegionHit> {
+        self.last_region_hit.take()
+    }
+
+    /// Take the latest async hover result (if any). Consumes it.
+    pub fn take_hover_hit(&mut self) -> Option<PickHit> {
+        self.last_hover_hit.take()
     }
 
     /// Take the latest pick result (if any). Consumes it.
@@ -304,6 +711,152 @@ impl PickSystem {
         self.pending_readback = None;
         self.last_hit = None;
         self.staged_keys.clear();
+        self.pending_hover = None;
+        self.last_hover_hit = None;
+        if self.pending_view_pick.take().is_some() {
+            self.abandon_view_pick();
+        }
+        self.view_pick_keys.clear();
+        self.pending_region = None;
+        self.last_region_hit = None;
+        self.scene_epoch += 1;
+        self.id_buffer_key = None;
+    }
+
+    /// Declare the state the next lookups are made against. Returns `true` when
+    /// the ID target is stale and `render_pick_pass` must run this frame;
+    /// `false` when the persistent buffer already holds this state.
+    pub fn prepare_id_pass(&mut self, state_key: u64) -> bool {
+        self.requested_state_key = Some(state_key);
+        if self.id_buffer_current() {
+            self.stats.id_pass_reuses += 1;
+            false
+        } else {
+            true
+        }
+    }
+
+    /// Mark that no ID pass applies to the next lookups (nothing is pickable
+    /// through it), so they resolve to no hit without reading the target.
+    pub fn skip_id_pass(&mut self) {
+        self.requested_state_key = None;
+    }
+
+    pub fn stats(&self) -> PickStats {
+        self.stats
+    }
+
+    /// Material the ID pass draws every pickable renderable with.
+    pub fn material(&self) -> &Material {
+        &self.pick_material
+    }
+
+    fn id_buffer_current(&self) -> bool {
+        self.id_buffer_key.is_some() && self.id_buffer_key == self.requested_state_key
+    }
+
+    pub fn set_backend(&mut self, backend: PickBackend) {
+        if backend == PickBackend::ViewPick && self.view_pick_query.is_none() {
+            log::warn!("View pick query unavailable; keeping the ID pick pass.");
+            return;
+        }
+        self.backend = backend;
+    }
+
+    pub fn backend(&self) -> PickBackend {
+        self.backend
+    }
+
+    /// Issue a `View::pick` query on the beauty view for the pending click and
+    /// remember which renderables map to which scene-mesh keys. Returns `false` when
+    /// the query could not be issued (busy slot, cursor outside the viewport),
+    /// in which case the caller should keep scene meshes in the ID pass.
+    pub fn issue_view_pick(&mut self, view: &View, pickables: &[(PickKey, Vec<Entity>)]) -> bool {
+        if !self.has_pending_pick() {
+            return false;
+        }
+        let Some((sx, sy)) = self.pending_pick else {
+            return false;
+        };
+        if self.pending_view_pick.is_some() {
+            return false;
+        }
+        let (px, py_flipped) = self.screen_to_pixel(sx, sy);
+        let Some(query) = self
+            .view_pick_query
+            .as_mut()
+            .and_then(ViewPickSlot::query_for_issue)
+        else {
+            return false;
+        };
+        if !view.pick(px, py_flipped, query) {
+            return false;
+        }
+        self.view_pick_keys.clear();
+        for (key, entities) in pickables {
+            if key.kind != PickKind::SceneMesh {
+                continue;
+            }
+            for entity in entities {
+                self.view_pick_keys.insert(entity.id, *key);
+            }
+        }
+        self.pending_view_pick = Some(PendingViewPick {
+            screen: (sx, sy),
+            epoch: self.scene_epoch,
+            overlay_hit: None,
+            frames_waited: 0,
+        });
+        true
+    }
+
+    /// Whether a click is waiting on a `View::pick` result.
+    pub fn awaiting_view_pick(&self) -> bool {
+        self.pending_view_pick.is_some()
+    }
+
+    /// Merge a completed `View::pick` result with the overlay ID-pass result.
+    /// Overlay handles win, matching what is drawn on top. Call once per frame
+    /// after `engine.pump_message_queues()`.
+    pub fn poll_view_pick(&mut self) {
+        let Some(pending) = &mut self.pending_view_pick else {
+            if let Some(slot) = &mut self.view_pick_query {
+                slot.drain();
+            }
+            return;
+        };
+        let Some(overlay_hit) = pending.overlay_hit else {
+            return;
+        };
+        let result = self.view_pick_query.as_mut().and_then(ViewPickSlot::poll);
+        if result.is_none() {
+            pending.frames_waited += 1;
+            if pending.frames_waited < VIEW_PICK_MAX_WAIT_FRAMES {
+                return;
+            }
+            log::debug!("View pick timed out; resolving click from the ID pass only.");
+            self.abandon_view_pick();
+        }
+        let Some(pending) = self.pending_view_pick.take() else {
+            return;
+        };
+        if pending.epoch != self.scene_epoch {
+            return;
+        }
+        let hit = if !overlay_hit.is_none() {
+            overlay_hit
+        } else {
+            result
+                .map(|result| resolve_view_pick(&result, &self.view_pick_keys, pending.screen))
+                .unwrap_or_else(PickHit::none)
+        };
+        self.last_hit = Some(hit);
+    }
+
+    fn abandon_view_pick(&mut self) {
+        if let Some(slot) = &mut self.view_pick_query {
+            slot.abandon();
+        }
     }
 
     /// Get or create a MaterialInstance for a given pick object_id.
@@ -320,69 +873,43 @@ impl PickSystem {
         &self.pick_instances[&packed]
     }
 
-    /// Execute the pick pass within a frame.
+    /// Execute the pick pass within a frame, after `prepare_id_pass` asked for it.
     ///
     /// This must be called between begin_frame() and end_frame().
     ///
     /// The flow:
-    /// 1. For each pickable entity: save original materials, set pick materials
+    /// 1. Push pick materials + pick layer for every pickable entity (one FFI call)
     /// 2. Render pick view to offscreen target
-    /// 3. Restore all original materials
+    /// 3. Pop the override set to restore original materials and layers (one FFI call)
     ///
     /// `pickable_entities` maps pick key -> list of filament entity IDs.
     pub fn render_pick_pass(
         &mut self,
-        engine: &mut Engine,
         renderer: &mut Renderer,
         pick_view: &View,
         pickable_entities: &[(PickKey, Vec<Entity>)],
     ) {
         self.staged_keys.clear();
-        // 1. Save and swap materials
-        let mut saved: Vec<(Entity, SavedMaterials)> = Vec::new();
-        let mut layer_restore: Vec<(Entity, u8)> = Vec::new();
-
-        for (key, entities) in pickable_entities {
-            // Pre-bake the pick instance. We need the pick instance pointer
-            // so that we can set it on each primitive.
+        for (key, _) in pickable_entities {
             self.ensure_pick_instance(*key);
-            let packed = u32::from_be_bytes(key.to_rgba());
-            self.staged_keys.insert(packed);
-            let pick_mi = &self.pick_instances[&packed];
-            let restore_layer = match key.kind {
-                PickKind::SceneMesh => LAYER_SCENE,
-                PickKind::GizmoAxis
-                | PickKind::GizmoPlane
-                | PickKind::GizmoRing
-                | PickKind::LightHelper => LAYER_OVERLAY,
-                _ => LAYER_SCENE,
-            };
+            self.staged_keys.insert(u32::from_be_bytes(key.to_rgba()));
+        }
 
-            for &entity in entities {
-                engine.renderable_set_layer_mask(entity, 0xFF, LAYER_PICK);
-                layer_restore.push((entity, restore_layer));
-                let prim_count = engine.renderable_primitive_count(entity);
-                let mut entries = Vec::with_capacity(prim_count as usize);
-                for p in 0..prim_count {
-                    let original = engine.renderable_get_material_raw(entity, p);
-                    entries.push((p, original));
-                    engine.renderable_set_material(entity, p, pick_mi);
-                }
-                saved.push((entity, SavedMaterials { entries }));
-            }
+        // 1. Swap materials and layers
+        let mut overrides: Vec<(Entity, &MaterialInstance, u8)> = Vec::new();
+        for (key, entities) in pickable_entities {
+            let pick_mi = &self.pick_instances[&u32::from_be_bytes(key.to_rgba())];
+            overrides.extend(entities.iter().map(|&entity| (entity, pick_mi, LAYER_PICK)));
         }
+        self.material_overrides.push(&overrides);
+
         // 2. Render pick view
         renderer.render(pick_view);
 
-        // 3. Restore original materials
-        for (entity, saved_mats) in &saved {
-            for &(prim_idx, raw_ptr) in &saved_mats.entries {
-                engine.renderable_restore_material_raw(*entity, prim_idx, raw_ptr);
-            }
-        }
-        for (entity, restore_layer) in &layer_restore {
-            engine.renderable_set_layer_mask(*entity, 0xFF, *restore_layer);
-        }
+        // 3. Restore original materials and layers
+        self.material_overrides.pop();
+        self.id_buffer_key = self.requested_state_key;
+        self.stats.id_pass_renders += 1;
     }
 
     /// Schedule a pixel readback at the pending pick location.
@@ -394,11 +921,13 @@ impl PickSystem {
         let Some((sx, sy)) = self.pending_pick.take() else {
             return false;
         };
-
-        // Convert screen coords to pixel coords in the pick buffer.
-        // Screen coordinates are top-left origin, OpenGL is bottom-left.
-        let px = (sx as u32).min(self.width.saturating_sub(1));
-        let py_flipped = self.height.saturating_sub(1).saturating_sub(sy as u32);
+        if !self.id_buffer_current() {
+            // The ID target does not hold the current state (View::pick backend
+            // with no overlay handles, or a skipped frame), so report no overlay hit.
+            self.resolve_id_hit(PickHit::none());
+            return false;
+        }
+        let (px, py_flipped) = self.screen_to_pixel(sx, sy);
 
         self.readback_buffer.fill(0);
         let ok = renderer.read_pixels(
@@ -414,7 +943,7 @@ impl PickSystem {
             self.pending_readback = Some((sx, sy, px, py_flipped));
         } else {
             log::warn!("Pick readback failed at ({},{})", px, py_flipped);
-            self.last_hit = Some(PickHit::none());
+            self.resolve_id_hit(PickHit::none());
         }
 
         ok
@@ -431,20 +960,333 @@ impl PickSystem {
             self.readback_buffer[2],
             self.readback_buffer[3],
         ];
-        let key = PickKey::from_rgba(rgba);
-        let packed = u32::from_be_bytes(rgba);
-        if !self.staged_keys.contains(&packed) {
-            self.last_hit = Some(PickHit::none());
-            return;
+        let hit = decode_pick_hit(rgba, &self.staged_keys, sx, sy);
+        self.resolve_id_hit(hit);
+    }
+
+    /// Route an ID-pass click result: straight to `last_hit`, or into the
+    /// pending view pick to be merged once its query completes.
+    fn resolve_id_hit(&mut self, hit: PickHit) {
+        match &mut self.pending_view_pick {
+            Some(pending) => pending.overlay_hit = Some(hit),
+            None => self.last_hit = Some(hit),
+        }
+    }
+
+    /// Start a non-blocking readback for the pending click pick. The result
+    /// reaches `take_hit` once a later poll finds it complete, merged with the
+    /// view pick when one was issued. Call after the frame containing the pick
+    /// pass has ended, before `schedule_async_readback` so the click gets a slot.
+    pub fn schedule_async_click_readback(&mut self, renderer: &mut Renderer) -> bool {
+        if !self.has_pending_pick() {
+            return false;
+        }
+        let Some((sx, sy)) = self.pending_pick.take() else {
+            return false;
+        };
+        if !self.id_buffer_current() {
+            self.resolve_id_hit(PickHit::none());
+            return false;
+        }
+        if !self.start_async_readback(renderer, (sx, sy), true) {
+            self.resolve_id_hit(PickHit::none());
+            return false;
+        }
+        true
+    }
+
+    /// Start a non-blocking readback for the pending hover pick, if a slot is
+    /// free. Call after the frame containing the pick pass has ended.
+    pub fn schedule_async_readback(&mut self, renderer: &mut Renderer) -> bool {
+        if !self.id_buffer_current() || self.free_async_slot().is_none() {
+            return false;
         }
-        self.last_hit = Some(PickHit {
-            key,
-            screen_x: sx,
-            screen_y: sy,
+        let Some(screen) = self.pending_hover.take() else {
+            return false;
+        };
+        if !self.start_async_readback(renderer, screen, false) {
+            return false;
+        }
+        self.next_hover_sequence += 1;
+        true
+    }
+
+    fn start_async_readback(
+        &mut self,
+        renderer: &mut Renderer,
+        (sx, sy): (f32, f32),
+        click: bool,
+    ) -> bool {
+        let Some(index) = self.free_async_slot() else {
+            return false;
+        };
+        let (px, py_flipped) = self.screen_to_pixel(sx, sy);
+        let sequence = self.next_hover_sequence;
+        let epoch = self.scene_epoch;
+        let slot = &mut self.async_slots[index];
+        if !renderer.read_pixels_async(&self.render_target, px, py_flipped, 1, 1, &mut slot.readback)
+        {
+            log::warn!("Async pick readback failed at ({},{})", px, py_flipped);
+            return false;
+        }
+        slot.screen = (sx, sy);
+        slot.click = click;
+        slot.epoch = epoch;
+        slot.sequence = sequence;
+        slot.valid_keys.clear();
+        slot.valid_keys.extend(self.staged_keys.iter().copied());
+        true
+    }
+
+    /// Decode any async readbacks that have completed. Call once per frame after
+    /// `engine.pump_message_queues()`; older results never replace newer ones.
+    pub fn poll_async_readbacks(&mut self) {
+        let mut rgba = [0u8; 4];
+        let mut click_hit = None;
+        for slot in &mut self.async_slots {
+            if !slot.readback.poll(&mut rgba) {
+                continue;
+            }
+            let (sx, sy) = slot.screen;
+            if slot.click {
+                if slot.epoch == self.scene_epoch {
+                    click_hit = Some(decode_pick_hit(rgba, &slot.valid_keys, sx, sy));
+                }
+                continue;
+            }
+            if slot.epoch != self.scene_epoch || slot.sequence <= self.latest_hover_sequence {
+                continue;
+            }
+            self.latest_hover_sequence = slot.sequence;
+            self.last_hover_hit = Some(decode_pick_hit(rgba, &slot.valid_keys, sx, sy));
+        }
+        if let Some(hit) = click_hit {
+            self.resolve_id_hit(hit);
+        } else if self
+            .pending_view_pick
+            .as_ref()
+            .map_or(false, |pending| pending.epoch != self.scene_epoch)
+        {
+            // A resize dropped the click's readback; release its view pick too.
+            self.pending_view_pick = None;
+            self.abandon_view_pick();
+        }
+    }
+
+    /// Start the readback for the pending region pick. Call after the frame
+    /// containing the pick pass has ended.
+    pub fn schedule_region_readback(&mut self, renderer: &mut Renderer) -> bool {
+        if self.pending_region.is_none() || !self.region_idle() {
+            return false;
+        }
+        let Some((screen_min, screen_max)) = self.pending_region.take() else {
+            return false;
+        };
+        if !self.id_buffer_current() {
+            // Nothing pickable went through the ID pass this frame.
+            self.last_region_hit = Some(PickRegionHit {
+                screen_min,
+                screen_max,
+                ..Default::default()
+            });
+            return false;
+        }
+        let (x, y, width, height) = self.screen_rect_to_pixels(screen_min, screen_max);
+        let byte_len = width * height * 4;
+        if self.region_readback_capacity < byte_len {
+            self.region_readback = AsyncReadback::new(byte_len);
+            self.region_readback_capacity = if self.region_readback.is_some() {
+                byte_len
+            } else {
+                0
+            };
+        }
+        let Some(readback) = &mut self.region_readback else {
+            log::warn!("Region pick readback unavailable ({}×{})", width, height);
+            return false;
+        };
+        if !renderer.read_pixels_async(&self.render_target, x, y, width, height, readback) {
+            log::warn!(
+                "Region pick readback failed at ({},{}) {}×{}",
+                x,
+                y,
+                width,
+                height
+            );
+            return false;
+        }
+        self.region_in_flight = Some(RegionReadback {
+            screen_min,
+            screen_max,
+            epoch: self.scene_epoch,
+            byte_len: byte_len as usize,
+            valid_keys: self.staged_keys.clone(),
         });
+        true
+    }
+
+    /// Hand a completed region readback to a worker thread for decoding, and
+    /// collect a finished decode. Call once per frame after
+    /// `engine.pump_message_queues()`.
+    pub fn poll_region_pick(&mut self) {
+        if let Some(in_flight) = &self.region_in_flight {
+            let Some(readback) = &mut self.region_readback else {
+                self.region_in_flight = None;
+                return;
+            };
+            self.region_pixels.resize(in_flight.byte_len, 0);
+            if readback.poll(&mut self.region_pixels) {
+                if let Some(in_flight) = self.region_in_flight.take() {
+                    let pixels = std::mem::take(&mut self.region_pixels);
+                    self.spawn_region_decode(in_flight, pixels);
+                }
+            }
+        }
+        let finished = self
+            .region_decode
+            .as_ref()
+            .map_or(false, |decode| decode.handle.is_finished());
+        if !finished {
+            return;
+        }
+        let Some(decode) = self.region_decode.take() else {
+            return;
+        };
+        match decode.handle.join() {
+            Ok(hit) if decode.epoch == self.scene_epoch => self.last_region_hit = Some(hit),
+            Ok(_) => {}
+            Err(_) => log::warn!("Region pick decode thread panicked"),
+        }
+    }
+
+    fn spawn_region_decode(&mut self, in_flight: RegionReadback, pixels: Vec<u8>) {
+        let RegionReadback {
+            screen_min,
+            screen_max,
+            epoch,
+            valid_keys,
+            ..
+        } = in_flight;
+        let decode = move || PickRegionHit {
+            screen_min,
+            screen_max,
+            pixel_count: (pixels.len() / 4) as u32,
+            coverage: decode_pick_region(&pixels, &valid_keys),
+        };
+        match std::thread::Builder::new()
+            .name("pick-region-decode".to_string())
+            .spawn(decode)
+        {
+            Ok(handle) => self.region_decode = Some(RegionDecode { epoch, handle }),
+            Err(err) => log::warn!("Failed to spawn region pick decode thread: {}", err),
+        }
+    }
+
+    fn region_idle(&self) -> bool {
+        self.region_in_flight.is_none() && self.region_decode.is_none()
+    }
+
+    /// Whether an async click readback can start: no earlier click is still
+    /// being read back or waiting on its view pick, and a slot is free. A view
+    /// pick issued for the pending click itself has no overlay result yet.
+    fn click_slot_ready(&self) -> bool {
+        let click_in_flight = self
+            .async_slots
+            .iter()
+            .any(|slot| slot.click && slot.readback.is_busy());
+        let view_pick_waiting = self
+            .pending_view_pick
+            .as_ref()
+            .map_or(false, |pending| pending.overlay_hit.is_some());
+        !click_in_flight && !view_pick_waiting && self.free_async_slot().is_some()
+    }
+
+    fn free_async_slot(&self) -> Option<usize> {
+        self.async_slots
+            .iter()
+            .position(|slot| !slot.readback.is_busy())
+    }
+
+    /// Convert top-left screen coordinates to bottom-left pick buffer pixels.
+    fn screen_to_pixel(&self, sx: f32, sy: f32) -> (u32, u32) {
+        let px = (sx as u32).min(self.width.saturating_sub(1));
+        let py_flipped = self.height.saturating_sub(1).saturating_sub(sy as u32);
+        (px, py_flipped)
+    }
+
+    /// Convert a top-left screen rectangle to a bottom-left pixel rectangle
+    /// (x, y, width, height) clamped to the pick buffer. Corners are inclusive.
+    fn screen_rect_to_pixels(&self, min: (f32, f32), max: (f32, f32)) -> (u32, u32, u32, u32) {
+        let (x0, top) = self.screen_to_pixel(min.0, min.1);
+        let (x1, bottom) = self.screen_to_pixel(max.0, max.1);
+        (x0, bottom, x1 - x0 + 1, top - bottom + 1)
+    }
+}
+
+/// Map a `View::pick` result to a scene hit via the renderables staged for it.
+fn resolve_view_pick(
+    result: &ViewPickResult,
+    keys: &HashMap<i32, PickKey>,
+    (sx, sy): (f32, f32),
+) -> PickHit {
+    let Some(key) = keys.get(&result.entity) else {
+        return PickHit::none();
+    };
+    PickHit {
+        key: *key,
+        screen_x: sx,
+        screen_y: sy,
+        depth: Some(result.depth),
+        world_position: Some([result.world_x, result.world_y, result.world_z]),
+    }
+}
+
+/// Decode a pick pixel, rejecting keys that were not staged for its pass.
+fn decode_pick_hit(rgba: [u8; 4], valid_keys: &HashSet<u32>, sx: f32, sy: f32) -> PickHit {
+    let packed = u32::from_be_bytes(rgba);
+    if !valid_keys.contains(&packed) {
+        return PickHit::none();
+    }
+    PickHit {
+        key: PickKey::from_rgba(rgba),
+        screen_x: sx,
+        screen_y: sy,
+        depth: None,
+        world_position: None,
     }
 }
 
+/// Count pixels per staged key in an RGBA8 region readback, largest coverage
+/// first. Runs of identical pixels share one set lookup.
+fn decode_pick_region(pixels: &[u8], valid_keys: &HashSet<u32>) -> Vec<(PickKey, u32)> {
+    let mut counts: HashMap<u32, u32> = HashMap::new();
+    let mut flush = |packed: u32, run: u32| {
+        if run > 0 && valid_keys.contains(&packed) {
+            *counts.entry(packed).or_insert(0) += run;
+        }
+    };
+    let mut run_key = 0u32;
+    let mut run_len = 0u32;
+    for pixel in pixels.chunks_exact(4) {
+        let packed = u32::from_be_bytes([pixel[0], pixel[1], pixel[2], pixel[3]]);
+        if packed == run_key {
+            run_len += 1;
+            continue;
+        }
+        flush(run_key, run_len);
+        run_key = packed;
+        run_len = 1;
+    }
+    flush(run_key, run_len);
+
+    let mut coverage: Vec<(u32, u32)> = counts.into_iter().collect();
+    coverage.sort_by(|a, b| b.1.cmp(&a.1).then(a.0.cmp(&b.0)));
+    coverage
+        .into_iter()
+        .map(|(packed, count)| (PickKey::from_rgba(packed.to_be_bytes()), count))
+        .collect()
+}
+
 // ========================================================================
 // Tests
 // ========================================================================
@@ -479,6 +1321,148 @@ mod tests {
         assert_eq!(decoded.sub_id, 255);
     }
 
+    #[test]
+    fn decode_pick_hit_rejects_unstaged_keys() {
+        let key = PickKey::scene_mesh(7);
+        let rgba = key.to_rgba();
+        let mut staged = HashSet::new();
+        assert!(decode_pick_hit(rgba, &staged, 1.0, 2.0).is_none());
+        staged.insert(u32::from_be_bytes(rgba));
+        let hit = decode_pick_hit(rgba, &staged, 1.0, 2.0);
+        assert_eq!(hit.key, key);
+        assert_eq!((hit.screen_x, hit.screen_y), (1.0, 2.0));
+    }
+
+    #[test]
+    fn resolve_view_pick_maps_staged_renderables() {
+        let key = PickKey::scene_mesh(3);
+        let mut keys = HashMap::new();
+        keys.insert(42, key);
+        let result = ViewPickResult {
+            entity: 42,
+            depth: 0.5,
+            world_x: 1.0,
+            world_y: 2.0,
+            world_z: 3.0,
+            ..Default::default()
+        };
+        let hit = resolve_view_pick(&result, &keys, (10.0, 20.0));
+        assert_eq!(hit.key, key);
+        assert_eq!(hit.depth, Some(0.5));
+        assert_eq!(hit.world_position, Some([1.0, 2.0, 3.0]));
+
+        let miss = ViewPickResult {
+            entity: 7,
+            ..Default::default()
+        };
+        assert!(resolve_view_pick(&miss, &keys, (0.0, 0.0)).is_none());
+    }
+
+    #[test]
+    fn decode_pick_region_counts_staged_coverage() {
+        let a = PickKey::scene_mesh(1);
+        let b = PickKey::new(PickKind::GizmoAxis, 0, 2);
+        let unstaged = PickKey::scene_mesh(9);
+        let mut staged = HashSet::new();
+        staged.insert(u32::from_be_bytes(a.to_rgba()));
+        staged.insert(u32::from_be_bytes(b.to_rgba()));
+
+        let mut pixels = Vec::new();
+        for key in [a, a, PickKey::NONE, b, a, unstaged, b, b, b] {
+            pixels.extend_from_slice(&key.to_rgba());
+        }
+        let coverage = decode_pick_region(&pixels, &staged);
+        assert_eq!(coverage, vec![(b, 4), (a, 3)]);
+
+        let hit = PickRegionHit {
+            coverage,
+            ..Default::default()
+        };
+        assert_eq!(
+            hit.dominant_key(|key| key.kind == PickKind::SceneMesh),
+            Some(a)
+        );
+        assert!(decode_pick_region(&[], &staged).is_empty());
+    }
+
+    #[test]
+    fn pick_state_key_is_stable_across_idle_frames() {
+        let pickables = vec![(PickKey::scene_mesh(0), vec![Entity { id: 5 }])];
+        let camera = [1.0; 16];
+        let mut state = PickSceneState::default();
+        let frame = |state: &mut PickSceneState| {
+            state.set_viewport([10, 20, 640, 480]);
+            state.key(&camera, (800, 600), &pickables)
+        };
+        let first = frame(&mut state);
+        assert_eq!(frame(&mut state), first);
+
+        state.set_viewport([10, 20, 640, 400]);
+        let resized = state.key(&camera, (800, 600), &pickables);
+        assert_ne!(resized, first);
+        state.invalidate();
+        assert_ne!(state.key(&camera, (800, 600), &pickables), resized);
+    }
+
+    #[derive(Default)]
+    struct FakeQuery {
+        in_flight: bool,
+        ready: Option<ViewPickResult>,
+    }
+
+    impl FakeQuery {
+        fn issue(&mut self) {
+            assert!(!self.is_busy());
+            self.in_flight = true;
+        }
+
+        fn complete(&mut self, entity: i32) {
+            self.in_flight = false;
+            self.ready = Some(ViewPickResult {
+                entity,
+                ..Default::default()
+            });
+        }
+    }
+
+    impl PickQuery for FakeQuery {
+        fn is_busy(&self) -> bool {
+            self.in_flight || self.ready.is_some()
+        }
+
+        fn poll(&mut self) -> Option<ViewPickResult> {
+            self.ready.take()
+        }
+    }
+
+    #[test]
+    fn timed_out_view_pick_is_drained_before_the_next_pick() {
+        let mut slot = ViewPickSlot::new(FakeQuery::default());
+        slot.query_for_issue().unwrap().issue();
+        assert!(slot.poll().is_none());
+        slot.abandon();
+
+        // Still in flight: the next click cannot use the slot yet.
+        assert!(slot.query_for_issue().is_none());
+        // The late result arrives and is dropped, not read as a new click's.
+        slot.query.complete(1);
+        assert!(slot.poll().is_none());
+        slot.query_for_issue().unwrap().issue();
+        slot.query.complete(2);
+        assert_eq!(slot.poll().map(|result| result.entity), Some(2));
+
+        // Abandoning an idle slot leaves it usable.
+        slot.abandon();
+        assert!(slot.query_for_issue().is_some());
+    }
+
+    #[test]
+    fn pick_readback_mode_parses() {
+        assert_eq!(PickReadbackMode::from_str("Async"), Some(PickReadbackMode::Async));
+        assert_eq!(PickReadbackMode::from_str("blocking"), Some(PickReadbackMode::Blocking));
+        assert_eq!(PickReadbackMode::from_str("later"), None);
+    }
+
     #[test]
     fn pick_key_float4_normalized() {
         let key = PickKey::scene_mesh(1);
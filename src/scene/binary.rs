@@ -0,0 +1,783 @@
+//! Versioned binary scene encoding.
+//!
+//! Layout (little-endian):
+//!
+//! ```text
+//! header      magic "PVZSCENE", version u32, section count u32,
+//!             next object id u64, reserved u64
+//! directory   per section: tag u32, record size u32, record count u32,
+//!             reserved u32, offset u64, byte length u64
+//! strings     count u32, (count + 1) u32 end offsets, UTF-8 bytes
+//! objects     fixed-size records, see `OBJECT_RECORD_SIZE`
+//! overrides   fixed-size records, see `OVERRIDE_RECORD_SIZE`
+//! bindings    fixed-size records, see `BINDING_RECORD_SIZE`
+//! ```
+//!
+//! Every string is stored once in the string table and referenced by index;
+//! `NO_STRING` encodes `None`. Records carry their size in the directory so a
+//! newer writer may append fields, and unknown sections are skipped. Records
+//! are decoded on access, so a mapped file can be inspected without building
+//! the whole `SceneState`.
+
+use super::{
+    AssetData, DirectionalLightData, EnvironmentData, LightData, LightShadowData, LightType,
+    MaterialOverrideData, MaterialOverrideEntry, MaterialTextureBindingData,
+    MaterialTextureBindingEntry, MediaSourceKind, SceneObject, SceneObjectKind, SceneState,
+    TextureColorSpace,
+};
+use memmap2::Mmap;
+use std::collections::HashMap;
+use std::path::Path;
+
+pub const MAGIC: &[u8; 8] = b"PVZSCENE";
+pub const VERSION: u32 = 1;
+
+const HEADER_SIZE: usize = 32;
+const DIRECTORY_ENTRY_SIZE: usize = 32;
+const NO_STRING: u32 = u32::MAX;
+
+const SECTION_STRINGS: u32 = 1;
+const SECTION_OBJECTS: u32 = 2;
+const SECTION_OVERRIDES: u32 = 3;
+const SECTION_BINDINGS: u32 = 4;
+
+/// id u64, name u32, kind u8, light type u8, flags u8, cascades u8,
+/// strings [u32; 3], shadow map size u32, floats [f32; 24].
+const OBJECT_RECORD_SIZE: usize = 128;
+const OBJECT_FLOATS: usize = 24;
+/// object id u64, material slot u64, asset path u32, material name u32,
+/// flags u32, floats [f32; 9].
+const OVERRIDE_RECORD_SIZE: usize = 64;
+/// object id u64, material slot u64, strings [u32; 4], source kind u8,
+/// color space u8, flags u8, reserved u8, floats [f32; 5].
+const BINDING_RECORD_SIZE: usize = 56;
+
+const KIND_ASSET: u8 = 0;
+const KIND_LIGHT: u8 = 1;
+const KIND_DIRECTIONAL_LIGHT: u8 = 2;
+const KIND_ENVIRONMENT: u8 = 3;
+
+const FLAG_CAST_SHADOWS: u8 = 1;
+const FLAG_HAS_OBJECT_ID: u32 = 1;
+const FLAG_HAS_SLOT: u32 = 2;
+const FLAG_WRAP_U: u8 = 1;
+const FLAG_WRAP_V: u8 = 2;
+
+#[derive(Debug, thiserror::Error)]
+pub enum BinarySceneError {
+    #[error("IO error: {0}")]
+    Io(#[from] std::io::Error),
+    #[error("not a binary scene file")]
+    BadMagic,
+    #[error("unsupported binary scene version {0}")]
+    UnsupportedVersion(u32),
+    #[error("malformed binary scene: {0}")]
+    Malformed(&'static str),
+}
+
+pub type Result<T> = std::result::Result<T, BinarySceneError>;
+
+/// Whether `bytes` start with the binary scene magic.
+pub fn is_binary_scene(bytes: &[u8]) -> bool {
+    bytes.starts_with(MAGIC)
+}
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+#[derive(Default)]
+struct StringTable<'a> {
+    indices: HashMap<&'a str, u32>,
+    strings: Vec<&'a str>,
+}
+
+impl<'a> StringTable<'a> {
+    fn intern(&mut self, value: &'a str) -> u32 {
+        if let Some(&index) = self.indices.get(value) {
+            return index;
+        }
+        let index = self.strings.len() as u32;
+        self.strings.push(value);
+        self.indices.insert(value, index);
+        index
+    }
+
+    fn intern_opt(&mut self, value: Option<&'a str>) -> u32 {
+        value.map_or(NO_STRING, |value| self.intern(value))
+    }
+
+    fn encode(&self) -> Vec<u8> {
+        let total: usize = self.strings.iter().map(|value| value.len()).sum();
+        let mut out = Vec::with_capacity(4 + 4 * (self.strings.len() + 1) + total);
+        out.extend_from_slice(&(self.strings.len() as u32).to_le_bytes());
+        let mut end = 0u32;
+        out.extend_from_slice(&end.to_le_bytes());
+        for value in &self.strings {
+            end += value.len() as u32;
+            out.extend_from_slice(&end.to_le_bytes());
+        }
+        for value in &self.strings {
+            out.extend_from_slice(value.as_bytes());
+        }
+        out
+    }
+}
+
+/// Fixed-size record builder; fields are written at explicit offsets.
+struct Record<const N: usize>([u8; N]);
+
+impl<const N: usize> Record<N> {
+    fn new() -> Self {
+        Self([0; N])
+    }
+
+    fn u8(&mut self, offset: usize, value: u8) {
+        self.0[offset] = value;
+    }
+
+    fn u32(&mut self, offset: usize, value: u32) {
+        self.0[offset..offset + 4].copy_from_slice(&value.to_le_bytes());
+    }
+
+    fn u64(&mut self, offset: usize, value: u64) {
+        self.0[offset..offset + 8].copy_from_slice(&value.to_le_bytes());
+    }
+
+    fn floats(&mut self, offset: usize, values: &[f32]) {
+        for (index, value) in values.iter().enumerate() {
+            self.u32(offset + index * 4, value.to_bits());
+        }
+    }
+}
+
+/// Encode `scene` as it is; legacy objects are kept, not migrated.
+pub fn encode(scene: &SceneState) -> Vec<u8> {
+    let mut strings = StringTable::default();
+
+    let mut objects = Vec::with_capacity(scene.objects.len() * OBJECT_RECORD_SIZE);
+    for object in &scene.objects {
+        let mut record = Record::<OBJECT_RECORD_SIZE>::new();
+        record.u64(0, object.id);
+        record.u32(8, strings.intern(&object.name));
+        let mut floats = [0.0f32; OBJECT_FLOATS];
+        match &object.kind {
+            SceneObjectKind::Asset(data) => {
+                record.u8(12, KIND_ASSET);
+                record.u32(16, strings.intern(&data.path));
+                floats[0..3].copy_from_slice(&data.position);
+                floats[3..6].copy_from_slice(&data.rotation_deg);
+                floats[6..9].copy_from_slice(&data.scale);
+            }
+            SceneObjectKind::Light(data) => {
+                record.u8(12, KIND_LIGHT);
+                record.u8(13, light_type_code(data.light_type));
+                record.u8(
+                    14,
+                    if data.shadow.cast_shadows {
+                        FLAG_CAST_SHADOWS
+                    } else {
+                        0
+                    },
+                );
+                record.u8(15, data.shadow.cascades);
+                record.u32(28, data.shadow.map_size);
+                floats[0..3].copy_from_slice(&data.color);
+                floats[3] = data.intensity;
+                floats[4..7].copy_from_slice(&data.position);
+                floats[7..10].copy_from_slice(&data.rotation_deg);
+                floats[10..13].copy_from_slice(&data.direction);
+                floats[13] = data.range;
+                floats[14] = data.spot_inner_deg;
+                floats[15] = data.spot_outer_deg;
+                floats[16] = data.sun_angular_radius_deg;
+                floats[17] = data.sun_halo_size;
+                floats[18] = data.sun_halo_falloff;
+                floats[19] = data.shadow.shadow_far;
+                floats[20] = data.shadow.near_hint;
+                floats[21] = data.shadow.far_hint;
+            }
+            SceneObjectKind::DirectionalLight(data) => {
+                record.u8(12, KIND_DIRECTIONAL_LIGHT);
+                floats[0..3].copy_from_slice(&data.color);
+                floats[3] = data.intensity;
+                floats[4..7].copy_from_slice(&data.direction);
+            }
+            SceneObjectKind::Environment(data) => {
+                record.u8(12, KIND_ENVIRONMENT);
+                record.u32(16, strings.intern(&data.hdr_path));
+                record.u32(20, strings.intern(&data.ibl_path));
+                record.u32(24, strings.intern(&data.skybox_path));
+                floats[0] = data.intensity;
+            }
+        }
+        record.floats(32, &floats);
+        objects.extend_from_slice(&record.0);
+    }
+
+    let mut overrides = Vec::with_capacity(scene.material_overrides.len() * OVERRIDE_RECORD_SIZE);
+    for entry in &scene.material_overrides {
+        let mut record = Record::<OVERRIDE_RECORD_SIZE>::new();
+        let mut flags = 0;
+        if let Some(object_id) = entry.object_id {
+            record.u64(0, object_id);
+            flags |= FLAG_HAS_OBJECT_ID;
+        }
+        if let Some(slot) = entry.material_slot {
+            record.u64(8, slot as u64);
+            flags |= FLAG_HAS_SLOT;
+        }
+        record.u32(16, strings.intern_opt(entry.asset_path.as_deref()));
+        record.u32(20, strings.intern(&entry.material_name));
+        record.u32(24, flags);
+        record.floats(28, &entry.data.base_color_rgba);
+        record.floats(44, &[entry.data.metallic, entry.data.roughness]);
+        record.floats(52, &entry.data.emissive_rgb);
+        overrides.extend_from_slice(&record.0);
+    }
+
+    let mut bindings = Vec::with_capacity(scene.texture_bindings.len() * BINDING_RECORD_SIZE);
+    for entry in &scene.texture_bindings {
+        let binding = &entry.binding;
+        let mut record = Record::<BINDING_RECORD_SIZE>::new();
+        record.u64(0, entry.object_id);
+        record.u64(8, entry.material_slot as u64);
+        record.u32(16, strings.intern(&binding.texture_param));
+        record.u32(20, strings.intern(&binding.source_path));
+        record.u32(24, strings.intern_opt(binding.runtime_ktx_path.as_deref()));
+        record.u32(28, strings.intern_opt(binding.source_hash.as_deref()));
+        record.u8(
+            32,
+            match binding.source_kind {
+                MediaSourceKind::Image => 0,
+                MediaSourceKind::Video => 1,
+            },
+        );
+        record.u8(
+            33,
+            match binding.color_space {
+                TextureColorSpace::Srgb => 0,
+                TextureColorSpace::Linear => 1,
+            },
+        );
+        let mut flags = 0;
+        if binding.wrap_repeat_u {
+            flags |= FLAG_WRAP_U;
+        }
+        if binding.wrap_repeat_v {
+            flags |= FLAG_WRAP_V;
+        }
+        record.u8(34, flags);
+        record.floats(36, &binding.uv_offset);
+        record.floats(44, &binding.uv_scale);
+        record.floats(52, &[binding.uv_rotation_deg]);
+        bindings.extend_from_slice(&record.0);
+    }
+
+    let strings_bytes = strings.encode();
+    let sections: [(u32, usize, usize, &[u8]); 4] = [
+        (SECTION_STRINGS, 0, strings.strings.len(), &strings_bytes),
+        (
+            SECTION_OBJECTS,
+            OBJECT_RECORD_SIZE,
+            scene.objects.len(),
+            &objects,
+        ),
+        (
+            SECTION_OVERRIDES,
+            OVERRIDE_RECORD_SIZE,
+            scene.material_overrides.len(),
+            &overrides,
+        ),
+        (
+            SECTION_BINDINGS,
+            BINDING_RECORD_SIZE,
+            scene.texture_bindings.len(),
+            &bindings,
+        ),
+    ];
+
+    let data_start = HEADER_SIZE + sections.len() * DIRECTORY_ENTRY_SIZE;
+    let data_len: usize = sections.iter().map(|section| section.3.len()).sum();
+    let mut out = Vec::with_capacity(data_start + data_len);
+    out.extend_from_slice(MAGIC);
+    out.extend_from_slice(&VERSION.to_le_bytes());
+    out.extend_from_slice(&(sections.len() as u32).to_le_bytes());
+    out.extend_from_slice(&scene.next_object_id.to_le_bytes());
+    out.extend_from_slice(&0u64.to_le_bytes());
+    let mut offset = data_start as u64;
+    for (tag, record_size, count, bytes) in &sections {
+        out.extend_from_slice(&tag.to_le_bytes());
+        out.extend_from_slice(&(*record_size as u32).to_le_bytes());
+        out.extend_from_slice(&(*count as u32).to_le_bytes());
+        out.extend_from_slice(&0u32.to_le_bytes());
+        out.extend_from_slice(&offset.to_le_bytes());
+        out.extend_from_slice(&(bytes.len() as u64).to_le_bytes());
+        offset += bytes.len() as u64;
+    }
+    for (_, _, _, bytes) in &sections {
+        out.extend_from_slice(bytes);
+    }
+    out
+}
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+#[derive(Debug, Clone, Copy, Default)]
+struct Section {
+    offset: usize,
+    len: usize,
+    count: usize,
+    record_size: usize,
+}
+
+/// A validated view over an encoded scene. Only the header, directory and
+/// string offsets are checked up front; records are decoded on access.
+pub struct BinaryScene<B: AsRef<[u8]>> {
+    bytes: B,
+    next_object_id: u64,
+    strings: Section,
+    objects: Section,
+    overrides: Section,
+    bindings: Section,
+}
+
+impl BinaryScene<Mmap> {
+    /// Map `path` read-only. The file must not be modified while mapped.
+    pub fn open(path: &Path) -> Result<Self> {
+        let file = std::fs::File::open(path)?;
+        // Safety: the mapping is read-only; scene files are not expected to
+        // be rewritten on disk while they are loaded.
+        let mapping = unsafe { Mmap::map(&file)? };
+        Self::parse(mapping)
+    }
+}
+
+impl<B: AsRef<[u8]>> BinaryScene<B> {
+    pub fn parse(bytes: B) -> Result<Self> {
+        let data = bytes.as_ref();
+        if !is_binary_scene(data) {
+            return Err(BinarySceneError::BadMagic);
+        }
+        if data.len() < HEADER_SIZE {
+            return Err(BinarySceneError::Malformed("truncated header"));
+        }
+        let version = read_u32(data, 8);
+        if version != VERSION {
+            return Err(BinarySceneError::UnsupportedVersion(version));
+        }
+        let section_count = read_u32(data, 12) as usize;
+        let next_object_id = read_u64(data, 16);
+        let directory_end = section_count
+            .checked_mul(DIRECTORY_ENTRY_SIZE)
+            .and_then(|len| len.checked_add(HEADER_SIZE))
+            .filter(|&end| end <= data.len())
+            .ok_or(BinarySceneError::Malformed("truncated section directory"))?;
+
+        let mut scene = Self {
+            next_object_id,
+            strings: Section::default(),
+            objects: Section::default(),
+            overrides: Section::default(),
+            bindings: Section::default(),
+            bytes,
+        };
+        let data = scene.bytes.as_ref();
+        let mut sections = [None; 4];
+        for entry in (HEADER_SIZE..directory_end).step_by(DIRECTORY_ENTRY_SIZE) {
+            let section = Section {
+                record_size: read_u32(data, entry + 4) as usize,
+                count: read_u32(data, entry + 8) as usize,
+                offset: usize::try_from(read_u64(data, entry + 16))
+                    .map_err(|_| BinarySceneError::Malformed("section offset"))?,
+                len: usize::try_from(read_u64(data, entry + 24))
+                    .map_err(|_| BinarySceneError::Malformed("section length"))?,
+            };
+            if section
+                .offset
+                .checked_add(section.len)
+                .map_or(true, |end| end > data.len())
+            {
+                return Err(BinarySceneError::Malformed("section out of bounds"));
+            }
+            let slot = match read_u32(data, entry) {
+                SECTION_STRINGS => 0,
+                SECTION_OBJECTS => 1,
+                SECTION_OVERRIDES => 2,
+                SECTION_BINDINGS => 3,
+                _ => continue,
+            };
+            sections[slot] = Some(section);
+        }
+        let [Some(strings), Some(objects), overrides, bindings] = sections else {
+            return Err(BinarySceneError::Malformed(
+                "missing string or object section",
+            ));
+        };
+        let overrides = overrides.unwrap_or_default();
+        let bindings = bindings.unwrap_or_default();
+        check_records(objects, OBJECT_RECORD_SIZE)?;
+        check_records(overrides, OVERRIDE_RECORD_SIZE)?;
+        check_records(bindings, BINDING_RECORD_SIZE)?;
+
+        let table = &data[strings.offset..strings.offset + strings.len];
+        let offsets_end = strings
+            .count
+            .checked_add(1)
+            .and_then(|count| count.checked_mul(4))
+            .and_then(|len| len.checked_add(4))
+            .filter(|&end| end <= table.len())
+            .ok_or(BinarySceneError::Malformed("truncated string table"))?;
+        if read_u32(table, 0) as usize != strings.count
+            || read_u32(table, offsets_end - 4) as usize != table.len() - offsets_end
+        {
+            return Err(BinarySceneError::Malformed("string table size mismatch"));
+        }
+
+        scene.strings = strings;
+        scene.objects = objects;
+        scene.overrides = overrides;
+        scene.bindings = bindings;
+        Ok(scene)
+    }
+
+    pub fn object_count(&self) -> usize {
+        self.objects.count
+    }
+
+    /// Name of object `index`, without decoding the rest of its record.
+    pub fn object_name(&self, index: usize) -> Result<&str> {
+        let record = self.record(self.objects, index)?;
+        self.string(read_u32(record, 8))
+    }
+
+    pub fn object(&self, index: usize) -> Result<SceneObject> {
+        let record = self.record(self.objects, index)?;
+        let floats = read_floats::<OBJECT_FLOATS>(record, 32);
+        let vec3 = |start: usize| [floats[start], floats[start + 1], floats[start + 2]];
+        let kind = match record[12] {
+            KIND_ASSET => SceneObjectKind::Asset(AssetData {
+                path: self.string(read_u32(record, 16))?.to_string(),
+                position: vec3(0),
+                rotation_deg: vec3(3),
+                scale: vec3(6),
+            }),
+            KIND_LIGHT => SceneObjectKind::Light(LightData {
+                light_type: light_type_from_code(record[13])?,
+                color: vec3(0),
+                intensity: floats[3],
+                position: vec3(4),
+                rotation_deg: vec3(7),
+                direction: vec3(10),
+                range: floats[13],
+                spot_inner_deg: floats[14],
+                spot_outer_deg: floats[15],
+                sun_angular_radius_deg: floats[16],
+                sun_halo_size: floats[17],
+                sun_halo_falloff: floats[18],
+                shadow: LightShadowData {
+                    cast_shadows: record[14] & FLAG_CAST_SHADOWS != 0,
+                    map_size: read_u32(record, 28),
+                    cascades: record[15],
+                    shadow_far: floats[19],
+                    near_hint: floats[20],
+                    far_hint: floats[21],
+                },
+            }),
+            KIND_DIRECTIONAL_LIGHT => SceneObjectKind::DirectionalLight(DirectionalLightData {
+                color: vec3(0),
+                intensity: floats[3],
+                direction: vec3(4),
+            }),
+            KIND_ENVIRONMENT => SceneObjectKind::Environment(EnvironmentData {
+                hdr_path: self.string(read_u32(record, 16))?.to_string(),
+                ibl_path: self.string(read_u32(record, 20))?.to_string(),
+                skybox_path: self.string(read_u32(record, 24))?.to_string(),
+                intensity: floats[0],
+            }),
+            _ => return Err(BinarySceneError::Malformed("unknown object kind")),
+        };
+        Ok(SceneObject {
+            id: read_u64(record, 0),
+            name: self.string(read_u32(record, 8))?.to_string(),
+            kind,
+        })
+    }
+
+    fn material_override(&self, index: usize) -> Result<MaterialOverrideEntry> {
+        let record = self.record(self.overrides, index)?;
+        let flags = read_u32(record, 24);
+        let floats = read_floats::<9>(record, 28);
+        Ok(MaterialOverrideEntry {
+            object_id: (flags & FLAG_HAS_OBJECT_ID != 0).then(|| read_u64(record, 0)),
+            asset_path: self.string_opt(read_u32(record, 16))?,
+            material_slot: if flags & FLAG_HAS_SLOT != 0 {
+                Some(read_usize(record, 8)?)
+            } else {
+                None
+            },
+            material_name: self.string(read_u32(record, 20))?.to_string(),
+            data: MaterialOverrideData {
+                base_color_rgba: [floats[0], floats[1], floats[2], floats[3]],
+                metallic: floats[4],
+                roughness: floats[5],
+                emissive_rgb: [floats[6], floats[7], floats[8]],
+            },
+        })
+    }
+
+    fn texture_binding(&self, index: usize) -> Result<MaterialTextureBindingEntry> {
+        let record = self.record(self.bindings, index)?;
+        let floats = read_floats::<5>(record, 36);
+        Ok(MaterialTextureBindingEntry {
+            object_id: read_u64(record, 0),
+            material_slot: read_usize(record, 8)?,
+            binding: MaterialTextureBindingData {
+                texture_param: self.string(read_u32(record, 16))?.to_string(),
+                source_kind: match record[32] {
+                    0 => MediaSourceKind::Image,
+                    1 => MediaSourceKind::Video,
+                    _ => return Err(BinarySceneError::Malformed("unknown media source kind")),
+                },
+                source_path: self.string(read_u32(record, 20))?.to_string(),
+                runtime_ktx_path: self.string_opt(read_u32(record, 24))?,
+                source_hash: self.string_opt(read_u32(record, 28))?,
+                wrap_repeat_u: record[34] & FLAG_WRAP_U != 0,
+                wrap_repeat_v: record[34] & FLAG_WRAP_V != 0,
+                color_space: match record[33] {
+                    0 => TextureColorSpace::Srgb,
+                    1 => TextureColorSpace::Linear,
+                    _ => return Err(BinarySceneError::Malformed("unknown color space")),
+                },
+                uv_offset: [floats[0], floats[1]],
+                uv_scale: [floats[2], floats[3]],
+                uv_rotation_deg: floats[4],
+            },
+        })
+    }
+
+    /// Decode every record into a `SceneState`, exactly as encoded.
+    pub fn to_scene(&self) -> Result<SceneState> {
+        Ok(SceneState {
+            objects: (0..self.objects.count)
+                .map(|index| self.object(index))
+                .collect::<Result<_>>()?,
+            material_overrides: (0..self.overrides.count)
+                .map(|index| self.material_override(index))
+                .collect::<Result<_>>()?,
+            texture_bindings: (0..self.bindings.count)
+                .map(|index| self.texture_binding(index))
+                .collect::<Result<_>>()?,
+            next_object_id: self.next_object_id,
+        })
+    }
+
+    fn record(&self, section: Section, index: usize) -> Result<&[u8]> {
+        if index >= section.count {
+            return Err(BinarySceneError::Malformed("record index out of range"));
+        }
+        let start = section.offset + index * section.record_size;
+        // Fields appended by newer writers lie past the known record size.
+        Ok(&self.bytes.as_ref()[start..start + section.record_size])
+    }
+
+    fn string(&self, index: u32) -> Result<&str> {
+        let index = index as usize;
+        if index >= self.strings.count {
+            return Err(BinarySceneError::Malformed("string index out of range"));
+        }
+        let table =
+            &self.bytes.as_ref()[self.strings.offset..self.strings.offset + self.strings.len];
+        let blob = 4 + 4 * (self.strings.count + 1);
+        let start = read_u32(table, 4 + index * 4) as usize;
+        let end = read_u32(table, 8 + index * 4) as usize;
+        let bytes = table
+            .get(blob + start..blob + end)
+            .filter(|_| start <= end)
+            .ok_or(BinarySceneError::Malformed("string out of bounds"))?;
+        std::str::from_utf8(bytes).map_err(|_| BinarySceneError::Malformed("string is not UTF-8"))
+    }
+
+    fn string_opt(&self, index: u32) -> Result<Option<String>> {
+        if index == NO_STRING {
+            return Ok(None);
+        }
+        self.string(index).map(|value| Some(value.to_string()))
+    }
+}
+
+fn check_records(section: Section, min_record_size: usize) -> Result<()> {
+    if section.count == 0 {
+        return Ok(());
+    }
+    if section.record_size < min_record_size {
+        return Err(BinarySceneError::Malformed("record size too small"));
+    }
+    match section.count.checked_mul(section.record_size) {
+        Some(len) if len <= section.len => Ok(()),
+        _ => Err(BinarySceneError::Malformed("record table out of bounds")),
+    }
+}
+
+fn light_type_code(light_type: LightType) -> u8 {
+    match light_type {
+        LightType::Directional => 0,
+        LightType::Sun => 1,
+        LightType::Point => 2,
+        LightType::Spot => 3,
+        LightType::FocusedSpot => 4,
+    }
+}
+
+fn light_type_from_code(code: u8) -> Result<LightType> {
+    Ok(match code {
+        0 => LightType::Directional,
+        1 => LightType::Sun,
+        2 => LightType::Point,
+        3 => LightType::Spot,
+        4 => LightType::FocusedSpot,
+        _ => return Err(BinarySceneError::Malformed("unknown light type")),
+    })
+}
+
+fn read_u32(bytes: &[u8], offset: usize) -> u32 {
+    u32::from_le_bytes(bytes[offset..offset + 4].try_into().expect("4-byte slice"))
+}
+
+fn read_u64(bytes: &[u8], offset: usize) -> u64 {
+    u64::from_le_bytes(bytes[offset..offset + 8].try_into().expect("8-byte slice"))
+}
+
+fn read_usize(bytes: &[u8], offset: usize) -> Result<usize> {
+    usize::try_from(read_u64(bytes, offset))
+        .map_err(|_| BinarySceneError::Malformed("material slot out of range"))
+}
+
+fn read_floats<const N: usize>(bytes: &[u8], offset: usize) -> [f32; N] {
+    std::array::from_fn(|index| f32::from_bits(read_u32(bytes, offset + index * 4)))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn sample_scene() -> SceneState {
+        let mut scene = SceneState::new();
+        scene.objects.push(SceneObject {
+            id: 3,
+            name: "Helmet".to_string(),
+            kind: SceneObjectKind::Asset(AssetData {
+                path: "assets/gltf/DamagedHelmet.gltf".to_string(),
+                position: [1.0, -2.5, 3.0],
+                rotation_deg: [0.0, 90.0, 0.0],
+                scale: [1.0, 1.0, 1.0],
+            }),
+        });
+        scene.objects.push(SceneObject {
+            id: 4,
+            name: "Helmet".to_string(),
+            kind: SceneObjectKind::Light(LightData::default_for(LightType::Spot)),
+        });
+        scene.objects.push(SceneObject {
+            id: 0,
+            name: "Light".to_string(),
+            kind: SceneObjectKind::DirectionalLight(DirectionalLightData {
+                color: [1.0, 0.5, 0.25],
+                intensity: 5.0,
+                direction: [0.0, -1.0, 0.0],
+            }),
+        });
+        scene.objects.push(SceneObject {
+            id: 5,
+            name: "Environment".to_string(),
+            kind: SceneObjectKind::Environment(EnvironmentData {
+                hdr_path: String::new(),
+                ibl_path: "ibl.ktx".to_string(),
+                skybox_path: "sky.ktx".to_string(),
+                intensity: 30_000.0,
+            }),
+        });
+        scene.material_overrides.push(MaterialOverrideEntry {
+            object_id: None,
+            asset_path: None,
+            material_slot: None,
+            material_name: "Legacy".to_string(),
+            data: MaterialOverrideData {
+                base_color_rgba: [0.1, 0.2, 0.3, 1.0],
+                metallic: 0.5,
+                roughness: 0.7,
+                emissive_rgb: [0.0, 0.0, 0.0],
+            },
+        });
+        scene.set_material_override(
+            3,
+            "assets/gltf/DamagedHelmet.gltf".to_string(),
+            1,
+            "Material_MR".to_string(),
+            MaterialOverrideData {
+                base_color_rgba: [1.0, 1.0, 1.0, 0.5],
+                metallic: 0.0,
+                roughness: 1.0,
+                emissive_rgb: [0.3, 0.2, 0.1],
+            },
+        );
+        scene.set_texture_binding(
+            3,
+            1,
+            MaterialTextureBindingData {
+                texture_param: "baseColorMap".to_string(),
+                source_kind: MediaSourceKind::Image,
+                source_path: "assets/textures/albedo.png".to_string(),
+                runtime_ktx_path: Some("assets/cache/textures/abc_srgb.ktx".to_string()),
+                source_hash: None,
+                wrap_repeat_u: false,
+                wrap_repeat_v: true,
+                color_space: TextureColorSpace::Linear,
+                uv_offset: [0.25, 0.5],
+                uv_scale: [2.0, 2.0],
+                uv_rotation_deg: 45.0,
+            },
+        );
+        scene.next_object_id = 6;
+        scene
+    }
+
+    #[test]
+    fn binary_roundtrip_is_lossless() {
+        let scene = sample_scene();
+        let bytes = encode(&scene);
+        let decoded = BinaryScene::parse(bytes.as_slice())
+            .expect("valid encoding")
+            .to_scene()
+            .expect("valid records");
+        assert_eq!(
+            serde_json::to_value(&decoded).unwrap(),
+            serde_json::to_value(&scene).unwrap()
+        );
+
+        // Repeated names and paths are interned once.
+        let view = BinaryScene::parse(bytes.as_slice()).unwrap();
+        assert_eq!(view.object_count(), 4);
+        assert_eq!(view.object_name(1).unwrap(), "Helmet");
+        assert_eq!(view.strings.count, 12);
+    }
+
+    #[test]
+    fn binary_parse_rejects_damage() {
+        let bytes = encode(&sample_scene());
+        assert!(matches!(
+            BinaryScene::parse(&b"{\"objects\": []}"[..]),
+            Err(BinarySceneError::BadMagic)
+        ));
+        let mut newer = bytes.clone();
+        newer[8] = 2;
+        assert!(matches!(
+            BinaryScene::parse(newer.as_slice()),
+            Err(BinarySceneError::UnsupportedVersion(2))
+        ));
+        let truncated = &bytes[..bytes.len() - 1];
+        assert!(BinaryScene::parse(truncated).is_err());
+    }
+}
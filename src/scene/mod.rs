@@ -1,6 +1,10 @@
+pub mod binary;
 pub mod serialization;
 
 use crate::filament::Entity;
+use std::collections::hash_map::DefaultHasher;
+use std::collections::HashMap;
+use std::hash::{Hash, Hasher};
 
 /// Asset-specific data - matches what can be edited in UI
 #[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
@@ -19,7 +23,7 @@ pub struct DirectionalLightData {
     pub direction: [f32; 3],
 }
 
-#[derive(Debug, Clone, Copy, PartialEq, Eq, serde::Serialize, serde::Deserialize)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, serde::Serialize, serde::Deserialize)]
 #[serde(rename_all = "snake_case")]
 pub enum LightType {
     Directional,
@@ -284,11 +288,57 @@ fn default_sun_halo_falloff() -> f32 {
     80.0
 }
 
+/// The kind of scene object a runtime object was built for.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub enum RuntimeKind {
+    #[default]
+    Empty,
+    Asset,
+    Light,
+    Environment,
+}
+
+impl RuntimeKind {
+    pub fn of(kind: &SceneObjectKind) -> Self {
+        match kind {
+            SceneObjectKind::Asset(_) => Self::Asset,
+            SceneObjectKind::Light(_) | SceneObjectKind::DirectionalLight(_) => Self::Light,
+            SceneObjectKind::Environment(_) => Self::Environment,
+        }
+    }
+}
+
 #[derive(Debug, Clone, Copy, Default)]
 pub struct RuntimeObject {
     pub root_entity: Option<Entity>,
+    /// World-space AABB: the local bounds under the root transform.
     pub center: [f32; 3],
     pub extent: [f32; 3],
+    /// Identity of the scene object this was built from, used to reconcile
+    /// the runtime against a changed `SceneState`.
+    pub object_id: u64,
+    pub kind: RuntimeKind,
+    /// `SceneState::rebuild_signature` of the object when it was built.
+    pub signature: u64,
+}
+
+/// What the light helpers draw for a light slot; its position is the slot's
+/// center.
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct RuntimeLight {
+    pub light_type: LightType,
+    pub direction: [f32; 3],
+}
+
+/// How to bring a `SceneRuntime` in line with a `SceneState`.
+#[derive(Debug, Default, PartialEq, Eq)]
+pub struct RuntimeDiff {
+    /// `(runtime index, scene index)` of objects kept and updated in place.
+    pub keep: Vec<(usize, usize)>,
+    /// Scene indices of objects to build.
+    pub create: Vec<usize>,
+    /// Runtime indices of objects to destroy.
+    pub destroy: Vec<usize>,
 }
 
 #[derive(Debug, Clone, PartialEq, serde::Serialize, serde::Deserialize)]
@@ -298,34 +348,250 @@ pub struct MaterialTextureBindingEntry {
     pub binding: MaterialTextureBindingData,
 }
 
+/// Runtime state of scene objects, stored column by column so per-frame
+/// passes touch only the fields they read. After a reconcile slot `i` holds
+/// scene object `i`; `slots` maps object ids to slots.
 #[derive(Default)]
 pub struct SceneRuntime {
-    objects: Vec<RuntimeObject>,
+    object_ids: Vec<u64>,
+    kinds: Vec<RuntimeKind>,
+    signatures: Vec<u64>,
+    root_entities: Vec<Option<Entity>>,
+    /// Root transform last handed out by `take_dirty_transforms`.
+    transforms: Vec<Option<[f32; 16]>>,
+    /// Bounds before the root transform (glTF bounding box, light position).
+    local_centers: Vec<[f32; 3]>,
+    local_extents: Vec<[f32; 3]>,
+    /// World AABBs, recomputed whenever the local bounds or transform change.
+    centers: Vec<[f32; 3]>,
+    extents: Vec<[f32; 3]>,
+    lights: Vec<Option<RuntimeLight>>,
+    /// Set when a slot's transform changed and has not been applied yet.
+    dirty: Vec<bool>,
+    slots: HashMap<u64, usize>,
 }
 
 impl SceneRuntime {
     pub fn new() -> Self {
-        Self { objects: Vec::new() }
+        Self::default()
     }
 
-    pub fn clear(&mut self) {
-        self.objects.clear();
+    pub fn push(&mut self, object: RuntimeObject) {
+        if object.kind != RuntimeKind::Empty {
+            self.slots
+                .entry(object.object_id)
+                .or_insert(self.object_ids.len());
+        }
+        self.object_ids.push(object.object_id);
+        self.kinds.push(object.kind);
+        self.signatures.push(object.signature);
+        self.root_entities.push(object.root_entity);
+        self.transforms.push(None);
+        self.local_centers.push(object.center);
+        self.local_extents.push(object.extent);
+        self.centers.push(object.center);
+        self.extents.push(object.extent);
+        self.lights.push(None);
+        self.dirty.push(false);
     }
 
-    pub fn push(&mut self, object: RuntimeObject) {
-        self.objects.push(object);
+    pub fn get(&self, index: usize) -> Option<RuntimeObject> {
+        Some(RuntimeObject {
+            root_entity: *self.root_entities.get(index)?,
+            center: self.centers[index],
+            extent: self.extents[index],
+            object_id: self.object_ids[index],
+            kind: self.kinds[index],
+            signature: self.signatures[index],
+        })
     }
 
-    pub fn get(&self, index: usize) -> Option<&RuntimeObject> {
-        self.objects.get(index)
+    pub fn root_entity(&self, index: usize) -> Option<Entity> {
+        self.root_entities.get(index).copied().flatten()
     }
 
-    pub fn get_mut(&mut self, index: usize) -> Option<&mut RuntimeObject> {
-        self.objects.get_mut(index)
+    /// Slot of the runtime built for `object_id`.
+    pub fn slot_of(&self, object_id: u64) -> Option<usize> {
+        self.slots.get(&object_id).copied()
+    }
+
+    pub fn set_root_entity(&mut self, index: usize, entity: Entity) {
+        if let Some(slot) = self.root_entities.get_mut(index) {
+            *slot = Some(entity);
+        }
+    }
+
+    /// Set the local bounds of slot `index`.
+    pub fn set_bounds(&mut self, index: usize, center: [f32; 3], extent: [f32; 3]) {
+        if index < self.local_centers.len() {
+            self.local_centers[index] = center;
+            self.local_extents[index] = extent;
+            self.update_world_bounds(index);
+        }
     }
 
-    pub fn replace(&mut self, objects: Vec<RuntimeObject>) {
-        self.objects = objects;
+    /// Record the light built for slot `index`: its position becomes the
+    /// slot's bounds.
+    pub fn set_light(&mut self, index: usize, light: &LightData) {
+        if index < self.lights.len() {
+            self.lights[index] = Some(RuntimeLight {
+                light_type: light.light_type,
+                direction: light.direction,
+            });
+            self.set_bounds(index, light.position, [0.0; 3]);
+        }
+    }
+
+    /// Light slots with their object id and position.
+    pub fn lights(&self) -> impl Iterator<Item = (usize, u64, RuntimeLight, [f32; 3])> + '_ {
+        self.lights.iter().enumerate().filter_map(|(index, light)| {
+            light.map(|light| (index, self.object_ids[index], light, self.centers[index]))
+        })
+    }
+
+    /// Where the transform gizmo sits for slot `index`: an asset's root
+    /// translation (the origin until a transform is recorded) or a light's
+    /// position.
+    pub fn origin(&self, index: usize) -> Option<[f32; 3]> {
+        match self.kinds.get(index)? {
+            RuntimeKind::Asset => {
+                Some(self.transforms[index].map_or([0.0; 3], |m| [m[12], m[13], m[14]]))
+            }
+            RuntimeKind::Light => Some(self.local_centers[index]),
+            RuntimeKind::Environment | RuntimeKind::Empty => None,
+        }
+    }
+
+    /// Record the root transform of slot `index`, marking it dirty only when
+    /// it differs from the one last applied.
+    pub fn set_transform(&mut self, index: usize, matrix: [f32; 16]) {
+        if let Some(slot) = self.transforms.get_mut(index) {
+            if *slot != Some(matrix) {
+                *slot = Some(matrix);
+                self.dirty[index] = true;
+                self.update_world_bounds(index);
+            }
+        }
+    }
+
+    fn update_world_bounds(&mut self, index: usize) {
+        let (center, extent) = (self.local_centers[index], self.local_extents[index]);
+        (self.centers[index], self.extents[index]) = match &self.transforms[index] {
+            Some(matrix) => transform_bounds(matrix, center, extent),
+            None => (center, extent),
+        };
+    }
+
+    /// Transforms changed since the last call, paired with their root entity.
+    pub fn take_dirty_transforms(&mut self) -> Vec<(Entity, [f32; 16])> {
+        let mut updates = Vec::new();
+        for index in 0..self.dirty.len() {
+            if !std::mem::take(&mut self.dirty[index]) {
+                continue;
+            }
+            if let (Some(entity), Some(matrix)) =
+                (self.root_entities[index], self.transforms[index])
+            {
+                updates.push((entity, matrix));
+            }
+        }
+        updates
+    }
+
+    /// Rebuild the store with `len` slots, moving each kept `(runtime index,
+    /// scene index)` pair into its scene slot. Other slots start empty.
+    pub fn reorder(&mut self, keep: &[(usize, usize)], len: usize) {
+        let mut next = Self::default();
+        next.object_ids.resize(len, 0);
+        next.kinds.resize(len, RuntimeKind::Empty);
+        next.signatures.resize(len, 0);
+        next.root_entities.resize(len, None);
+        next.transforms.resize(len, None);
+        next.local_centers.resize(len, [0.0; 3]);
+        next.local_extents.resize(len, [0.0; 3]);
+        next.centers.resize(len, [0.0; 3]);
+        next.extents.resize(len, [0.0; 3]);
+        next.lights.resize(len, None);
+        next.dirty.resize(len, false);
+        for &(from, to) in keep {
+            if from >= self.object_ids.len() || to >= len {
+                continue;
+            }
+            next.object_ids[to] = self.object_ids[from];
+            next.kinds[to] = self.kinds[from];
+            next.signatures[to] = self.signatures[from];
+            next.root_entities[to] = self.root_entities[from];
+            next.transforms[to] = self.transforms[from];
+            next.local_centers[to] = self.local_centers[from];
+            next.local_extents[to] = self.local_extents[from];
+            next.centers[to] = self.centers[from];
+            next.extents[to] = self.extents[from];
+            next.lights[to] = self.lights[from];
+            next.dirty[to] = self.dirty[from];
+            next.slots.insert(next.object_ids[to], to);
+        }
+        *self = next;
+    }
+
+    /// Record that the runtime object at `index` matches scene object `index`.
+    pub fn sync_identity(&mut self, index: usize, scene: &SceneState) {
+        if let Some(object) = scene.objects.get(index) {
+            self.set_identity(index, object, scene.rebuild_signature(object));
+        }
+    }
+
+    /// `sync_identity` for every scene object, after a reconcile.
+    pub fn sync_identities(&mut self, scene: &SceneState) {
+        for (index, signature) in scene.rebuild_signatures().into_iter().enumerate() {
+            self.set_identity(index, &scene.objects[index], signature);
+        }
+    }
+
+    fn set_identity(&mut self, index: usize, object: &SceneObject, signature: u64) {
+        if index >= self.object_ids.len() {
+            return;
+        }
+        let previous = self.object_ids[index];
+        if self.slots.get(&previous) == Some(&index) {
+            self.slots.remove(&previous);
+        }
+        self.object_ids[index] = object.id;
+        self.kinds[index] = RuntimeKind::of(&object.kind);
+        if self.kinds[index] != RuntimeKind::Light {
+            self.lights[index] = None;
+        }
+        self.signatures[index] = signature;
+        self.slots.insert(object.id, index);
+    }
+
+    /// Match runtime objects to `scene` objects by id. An object is kept when
+    /// its kind and rebuild signature are unchanged (and, for assets, it loaded);
+    /// anything else is destroyed and built again.
+    pub fn diff(&self, scene: &SceneState) -> RuntimeDiff {
+        let mut claimed = vec![false; self.object_ids.len()];
+        let mut diff = RuntimeDiff::default();
+        let signatures = scene.rebuild_signatures();
+        for (scene_index, object) in scene.objects.iter().enumerate() {
+            let kind = RuntimeKind::of(&object.kind);
+            let reusable = self.slot_of(object.id).filter(|&index| {
+                !claimed[index]
+                    && self.object_ids[index] == object.id
+                    && self.kinds[index] == kind
+                    && self.signatures[index] == signatures[scene_index]
+                    && (kind != RuntimeKind::Asset || self.root_entities[index].is_some())
+            });
+            match reusable {
+                Some(index) => {
+                    claimed[index] = true;
+                    diff.keep.push((index, scene_index));
+                }
+                None => diff.create.push(scene_index),
+            }
+        }
+        diff.destroy = (0..self.object_ids.len())
+            .filter(|&index| !claimed[index])
+            .collect();
+        diff
     }
 }
 
@@ -490,6 +756,23 @@ impl SceneState {
         }
     }
 
+    /// Hash of the parts of `object` that can only be applied by building it
+    /// again: an asset's path, material overrides and texture bindings, an
+    /// environment's textures, or a light's type (Filament cannot change the
+    /// type of an existing light). Everything else is updated in place.
+    pub fn rebuild_signature(&self, object: &SceneObject) -> u64 {
+        RebuildSignatures::new(self).of(object)
+    }
+
+    /// `rebuild_signature` of every object, in order.
+    pub fn rebuild_signatures(&self) -> Vec<u64> {
+        let signatures = RebuildSignatures::new(self);
+        self.objects
+            .iter()
+            .map(|object| signatures.of(object))
+            .collect()
+    }
+
     pub fn remove_object(&mut self, index: usize) -> Option<SceneObject> {
         if index >= self.objects.len() {
             return None;
@@ -510,6 +793,96 @@ impl SceneState {
 
 }
 
+/// World AABB of a local box under the column-major affine `matrix`.
+fn transform_bounds(
+    matrix: &[f32; 16],
+    center: [f32; 3],
+    extent: [f32; 3],
+) -> ([f32; 3], [f32; 3]) {
+    let mut world_center = [matrix[12], matrix[13], matrix[14]];
+    let mut world_extent = [0.0; 3];
+    for row in 0..3 {
+        for column in 0..3 {
+            let m = matrix[column * 4 + row];
+            world_center[row] += m * center[column];
+            world_extent[row] += m.abs() * extent[column];
+        }
+    }
+    (world_center, world_extent)
+}
+
+/// Material override and texture binding hashes grouped by the objects they
+/// apply to, so signing every object takes one pass over each list.
+struct RebuildSignatures {
+    overrides_by_object: HashMap<u64, Vec<u64>>,
+    overrides_by_path: HashMap<String, Vec<u64>>,
+    overrides_for_all: Vec<u64>,
+    bindings_by_object: HashMap<u64, Vec<u64>>,
+}
+
+impl RebuildSignatures {
+    fn new(scene: &SceneState) -> Self {
+        let mut signatures = Self {
+            overrides_by_object: HashMap::new(),
+            overrides_by_path: HashMap::new(),
+            overrides_for_all: Vec::new(),
+            bindings_by_object: HashMap::new(),
+        };
+        for entry in &scene.material_overrides {
+            let hash = entry_hash(entry);
+            match (entry.object_id, &entry.asset_path) {
+                (Some(object_id), _) => signatures
+                    .overrides_by_object
+                    .entry(object_id)
+                    .or_default()
+                    .push(hash),
+                (None, Some(path)) => signatures
+                    .overrides_by_path
+                    .entry(path.clone())
+                    .or_default()
+                    .push(hash),
+                (None, None) => signatures.overrides_for_all.push(hash),
+            }
+        }
+        for entry in &scene.texture_bindings {
+            signatures
+                .bindings_by_object
+                .entry(entry.object_id)
+                .or_default()
+                .push(entry_hash(entry));
+        }
+        signatures
+    }
+
+    fn of(&self, object: &SceneObject) -> u64 {
+        let mut hasher = DefaultHasher::new();
+        match &object.kind {
+            SceneObjectKind::Asset(data) => {
+                data.path.hash(&mut hasher);
+                self.overrides_by_object.get(&object.id).hash(&mut hasher);
+                self.overrides_by_path.get(&data.path).hash(&mut hasher);
+                self.overrides_for_all.hash(&mut hasher);
+                self.bindings_by_object.get(&object.id).hash(&mut hasher);
+            }
+            SceneObjectKind::Environment(data) => {
+                data.ibl_path.hash(&mut hasher);
+                data.skybox_path.hash(&mut hasher);
+            }
+            SceneObjectKind::Light(data) => data.light_type.hash(&mut hasher),
+            SceneObjectKind::DirectionalLight(_) => LightType::Directional.hash(&mut hasher),
+        }
+        hasher.finish()
+    }
+}
+
+fn entry_hash(entry: &impl serde::Serialize) -> u64 {
+    let mut hasher = DefaultHasher::new();
+    serde_json::to_string(entry)
+        .unwrap_or_default()
+        .hash(&mut hasher);
+    hasher.finish()
+}
+
 pub fn compose_transform_matrix(
     position: [f32; 3],
     rotation_deg: [f32; 3],
@@ -555,3 +928,176 @@ pub fn compose_transform_matrix(
         1.0,
     ]
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn asset(id: u64, path: &str) -> SceneObject {
+        SceneObject {
+            id,
+            name: path.to_string(),
+            kind: SceneObjectKind::Asset(AssetData {
+                path: path.to_string(),
+                position: [0.0; 3],
+                rotation_deg: [0.0; 3],
+                scale: [1.0; 3],
+            }),
+        }
+    }
+
+    fn built(scene: &SceneState) -> SceneRuntime {
+        let mut runtime = SceneRuntime::new();
+        for index in 0..scene.objects().len() {
+            runtime.push(RuntimeObject {
+                root_entity: Some(Entity {
+                    id: index as i32 + 1,
+                }),
+                ..RuntimeObject::default()
+            });
+            runtime.sync_identity(index, scene);
+        }
+        runtime
+    }
+
+    #[test]
+    fn diff_keeps_unchanged_objects_by_id() {
+        let mut scene = SceneState::new();
+        scene.add_object(asset(1, "a.glb"));
+        scene.add_object(asset(2, "b.glb"));
+        scene.ensure_object_ids();
+        scene.add_light("Point Light", LightData::default_for(LightType::Point));
+        let runtime = built(&scene);
+        assert_eq!(runtime.diff(&scene).keep.len(), 3);
+
+        // Deleting the first object keeps the others at shifted indices.
+        scene.remove_object(0);
+        let diff = runtime.diff(&scene);
+        assert_eq!(diff.keep, vec![(1, 0), (2, 1)]);
+        assert!(diff.create.is_empty());
+        assert_eq!(diff.destroy, vec![0]);
+
+        // A new path or texture binding for the same id rebuilds that asset.
+        if let Some(object) = scene.object_mut(0) {
+            object.kind = asset(2, "c.glb").kind;
+        }
+        let diff = runtime.diff(&scene);
+        assert_eq!(diff.keep, vec![(2, 1)]);
+        assert_eq!(diff.create, vec![0]);
+        assert_eq!(diff.destroy, vec![0, 1]);
+    }
+
+    #[test]
+    fn diff_rebuilds_light_when_its_type_changes() {
+        let mut scene = SceneState::new();
+        scene.add_light("Light", LightData::default_for(LightType::Point));
+        scene.add_light("Light", LightData::default_for(LightType::Point));
+        let runtime = built(&scene);
+
+        if let Some(object) = scene.object_mut(1) {
+            object.kind = SceneObjectKind::Light(LightData::default_for(LightType::Spot));
+        }
+        let diff = runtime.diff(&scene);
+        assert_eq!(diff.keep, vec![(0, 0)]);
+        assert_eq!(diff.create, vec![1]);
+        assert_eq!(diff.destroy, vec![1]);
+
+        // Moving a light or changing its colour is applied in place.
+        if let Some(SceneObjectKind::Light(light)) = scene.object_mut(0).map(|o| &mut o.kind) {
+            light.position = [1.0, 2.0, 3.0];
+            light.color = [0.5, 0.5, 0.5];
+        }
+        assert_eq!(runtime.diff(&scene).keep.len(), 1);
+    }
+
+    #[test]
+    fn reorder_moves_slots_and_tracks_dirty_transforms() {
+        let mut scene = SceneState::new();
+        scene.add_object(asset(1, "a.glb"));
+        scene.add_object(asset(2, "b.glb"));
+        let mut runtime = built(&scene);
+        let identity = compose_transform_matrix([0.0; 3], [0.0; 3], [1.0; 3]);
+        let moved = compose_transform_matrix([1.0, 0.0, 0.0], [0.0; 3], [1.0; 3]);
+        runtime.set_transform(0, moved);
+        runtime.set_transform(1, identity);
+        assert_eq!(runtime.take_dirty_transforms().len(), 2);
+        runtime.set_transform(1, identity);
+        assert!(runtime.take_dirty_transforms().is_empty());
+
+        scene.remove_object(0);
+        let diff = runtime.diff(&scene);
+        runtime.reorder(&diff.keep, scene.objects().len());
+        assert_eq!(runtime.slot_of(1), None);
+        assert_eq!(runtime.slot_of(2), Some(0));
+        assert_eq!(runtime.root_entity(0), Some(Entity { id: 2 }));
+        runtime.set_transform(0, identity);
+        assert!(runtime.take_dirty_transforms().is_empty());
+    }
+
+    #[test]
+    fn light_and_origin_columns_track_updates() {
+        let mut scene = SceneState::new();
+        scene.add_object(asset(1, "a.glb"));
+        let mut light = LightData::default_for(LightType::Spot);
+        scene.add_light("Spot", light.clone());
+        let mut runtime = built(&scene);
+        runtime.set_light(1, &light);
+
+        assert_eq!(runtime.origin(0), Some([0.0; 3]));
+        runtime.set_transform(
+            0,
+            compose_transform_matrix([4.0, 5.0, 6.0], [0.0; 3], [1.0; 3]),
+        );
+        assert_eq!(runtime.origin(0), Some([4.0, 5.0, 6.0]));
+
+        light.position = [1.0, 2.0, 3.0];
+        light.direction = [0.0, -1.0, 0.0];
+        runtime.set_light(1, &light);
+        let lights: Vec<_> = runtime.lights().collect();
+        assert_eq!(lights.len(), 1);
+        let (index, object_id, helper, position) = lights[0];
+        assert_eq!((index, object_id), (1, scene.objects()[1].id));
+        assert_eq!(helper.light_type, LightType::Spot);
+        assert_eq!(helper.direction, [0.0, -1.0, 0.0]);
+        assert_eq!(position, [1.0, 2.0, 3.0]);
+        assert_eq!(runtime.origin(1), Some([1.0, 2.0, 3.0]));
+
+        // Deleting the asset moves the light into slot 0.
+        scene.remove_object(0);
+        let diff = runtime.diff(&scene);
+        runtime.reorder(&diff.keep, scene.objects().len());
+        runtime.sync_identities(&scene);
+        assert_eq!(runtime.lights().next().map(|light| light.0), Some(0));
+    }
+
+    #[test]
+    fn world_bounds_follow_local_bounds_and_transform() {
+        let mut scene = SceneState::new();
+        scene.add_object(asset(1, "a.glb"));
+        let mut runtime = built(&scene);
+        runtime.set_bounds(0, [1.0, 0.0, 0.0], [1.0, 2.0, 3.0]);
+        let world = |runtime: &SceneRuntime| {
+            let object = runtime.get(0).unwrap();
+            (object.center, object.extent)
+        };
+        assert_eq!(world(&runtime), ([1.0, 0.0, 0.0], [1.0, 2.0, 3.0]));
+
+        runtime.set_transform(
+            0,
+            compose_transform_matrix([0.0, 5.0, 0.0], [0.0; 3], [2.0; 3]),
+        );
+        assert_eq!(world(&runtime), ([2.0, 5.0, 0.0], [2.0, 4.0, 6.0]));
+
+        runtime.set_transform(
+            0,
+            compose_transform_matrix([0.0; 3], [0.0, 90.0, 0.0], [1.0; 3]),
+        );
+        let (center, extent) = world(&runtime);
+        assert!((center[2] + 1.0).abs() < 1e-5);
+        assert!((extent[0] - 3.0).abs() < 1e-5 && (extent[2] - 1.0).abs() < 1e-5);
+
+        runtime.set_bounds(0, [0.0; 3], [1.0; 3]);
+        let (_, extent) = world(&runtime);
+        assert!((extent[0] - 1.0).abs() < 1e-5);
+    }
+}
@@ -1,5 +1,15 @@
-use crate::scene::SceneState;
+use crate::scene::binary::{self, BinaryScene, BinarySceneError};
+use crate::scene::{
+    AssetData, LightData, LightType, MaterialOverrideData, MaterialTextureBindingData,
+    MediaSourceKind, SceneObject, SceneObjectKind, SceneState, TextureColorSpace,
+};
+use std::io::Read;
 use std::path::Path;
+use std::time::{Duration, Instant};
+
+/// Scenes saved with this extension use the binary encoding; anything else
+/// is written as JSON. Loading detects the format from the file contents.
+pub const BINARY_SCENE_EXTENSION: &str = "pvzscene";
 
 #[derive(Debug, thiserror::Error)]
 pub enum SerializationError {
@@ -7,24 +17,184 @@ pub enum SerializationError {
     Io(#[from] std::io::Error),
     #[error("JSON error: {0}")]
     Json(#[from] serde_json::Error),
+    #[error("Binary scene error: {0}")]
+    Binary(#[from] BinarySceneError),
 }
 
 pub type Result<T> = std::result::Result<T, SerializationError>;
 
+fn is_binary_path(path: &Path) -> bool {
+    path.extension()
+        .and_then(|ext| ext.to_str())
+        .is_some_and(|ext| ext.eq_ignore_ascii_case(BINARY_SCENE_EXTENSION))
+}
+
 pub fn save_scene_to_file(scene: &SceneState, path: &Path) -> Result<()> {
+    if is_binary_path(path) {
+        std::fs::write(path, binary::encode(scene))?;
+        return Ok(());
+    }
     let json = serde_json::to_string_pretty(scene)?;
     std::fs::write(path, json)?;
     Ok(())
 }
 
 pub fn load_scene_from_file(path: &Path) -> Result<SceneState> {
-    let json = std::fs::read_to_string(path)?;
-    let mut scene: SceneState = serde_json::from_str(&json)?;
+    let mut scene = read_scene_file(path)?;
     scene.migrate_legacy_light_objects();
     scene.ensure_object_ids();
     Ok(scene)
 }
 
+/// Read a scene in either format without migrating it.
+fn read_scene_file(path: &Path) -> Result<SceneState> {
+    let mut magic = [0u8; binary::MAGIC.len()];
+    let mut file = std::fs::File::open(path)?;
+    let read = file.read(&mut magic)?;
+    drop(file);
+    if binary::is_binary_scene(&magic[..read]) {
+        return Ok(BinaryScene::open(path)?.to_scene()?);
+    }
+    let json = std::fs::read_to_string(path)?;
+    Ok(serde_json::from_str(&json)?)
+}
+
+/// Rewrite `input` in the format implied by `output`'s extension. The scene
+/// is copied as stored, so converting back yields the same document.
+pub fn convert_scene_file(input: &Path, output: &Path) -> Result<()> {
+    let scene = read_scene_file(input)?;
+    save_scene_to_file(&scene, output)
+}
+
+/// Load times for one synthetic scene written in both formats. Each figure
+/// is the best of `SCENE_BENCH_RUNS` runs.
+#[derive(Debug, Clone, serde::Serialize)]
+pub struct SceneFormatBench {
+    pub objects: usize,
+    pub json_bytes: u64,
+    pub binary_bytes: u64,
+    /// Read and parse the JSON file.
+    pub json_load_ms: f64,
+    /// Map the binary file and decode every record.
+    pub binary_load_ms: f64,
+    /// Map the binary file and read only the object names.
+    pub binary_scan_ms: f64,
+}
+
+const SCENE_BENCH_RUNS: usize = 5;
+
+pub fn benchmark_scene_formats(object_count: usize, dir: &Path) -> Result<SceneFormatBench> {
+    let scene = synthetic_scene(object_count);
+    std::fs::create_dir_all(dir)?;
+    let json_path = dir.join("scene_bench.json");
+    let binary_path = dir.join(format!("scene_bench.{}", BINARY_SCENE_EXTENSION));
+    save_scene_to_file(&scene, &json_path)?;
+    save_scene_to_file(&scene, &binary_path)?;
+
+    let json_load = best_of(|| {
+        let json = std::fs::read_to_string(&json_path)?;
+        let loaded: SceneState = serde_json::from_str(&json)?;
+        Ok(loaded.objects.len())
+    })?;
+    let binary_load = best_of(|| Ok(BinaryScene::open(&binary_path)?.to_scene()?.objects.len()))?;
+    let binary_scan = best_of(|| {
+        let view = BinaryScene::open(&binary_path)?;
+        let mut named = 0;
+        for index in 0..view.object_count() {
+            named += usize::from(!view.object_name(index)?.is_empty());
+        }
+        Ok(named)
+    })?;
+
+    let bench = SceneFormatBench {
+        objects: object_count,
+        json_bytes: std::fs::metadata(&json_path)?.len(),
+        binary_bytes: std::fs::metadata(&binary_path)?.len(),
+        json_load_ms: ms(json_load),
+        binary_load_ms: ms(binary_load),
+        binary_scan_ms: ms(binary_scan),
+    };
+    let _ = std::fs::remove_file(&json_path);
+    let _ = std::fs::remove_file(&binary_path);
+    Ok(bench)
+}
+
+fn best_of(mut run: impl FnMut() -> Result<usize>) -> Result<Duration> {
+    let mut best = Duration::MAX;
+    for _ in 0..SCENE_BENCH_RUNS {
+        let start = Instant::now();
+        std::hint::black_box(run()?);
+        best = best.min(start.elapsed());
+    }
+    Ok(best)
+}
+
+fn ms(value: Duration) -> f64 {
+    value.as_secs_f64() * 1000.0
+}
+
+/// Assets sharing a handful of paths, with a light and a texture binding
+/// every few objects, roughly the mix of a dressed set.
+fn synthetic_scene(object_count: usize) -> SceneState {
+    let mut scene = SceneState::new();
+    for index in 0..object_count {
+        let id = index as u64 + 1;
+        let offset = index as f32;
+        let kind = if index % 8 == 7 {
+            SceneObjectKind::Light(LightData {
+                position: [offset, 3.0, 0.0],
+                ..LightData::default_for(LightType::Point)
+            })
+        } else {
+            let path = format!("assets/gltf/prop_{:02}.glb", index % 16);
+            if index % 4 == 0 {
+                scene.set_texture_binding(
+                    id,
+                    0,
+                    MaterialTextureBindingData {
+                        texture_param: "baseColorMap".to_string(),
+                        source_kind: MediaSourceKind::Image,
+                        source_path: format!("assets/textures/prop_{:02}.png", index % 16),
+                        runtime_ktx_path: None,
+                        source_hash: None,
+                        wrap_repeat_u: true,
+                        wrap_repeat_v: true,
+                        color_space: TextureColorSpace::Srgb,
+                        uv_offset: [0.0, 0.0],
+                        uv_scale: [1.0, 1.0],
+                        uv_rotation_deg: 0.0,
+                    },
+                );
+                scene.set_material_override(
+                    id,
+                    path.clone(),
+                    0,
+                    "Material".to_string(),
+                    MaterialOverrideData {
+                        base_color_rgba: [1.0, 1.0, 1.0, 1.0],
+                        metallic: 0.0,
+                        roughness: 0.5,
+                        emissive_rgb: [0.0, 0.0, 0.0],
+                    },
+                );
+            }
+            SceneObjectKind::Asset(AssetData {
+                path,
+                position: [offset, 0.0, -offset],
+                rotation_deg: [0.0, offset * 15.0, 0.0],
+                scale: [1.0, 1.0, 1.0],
+            })
+        };
+        scene.objects.push(SceneObject {
+            id,
+            name: format!("Object {}", id),
+            kind,
+        });
+    }
+    scene.next_object_id = object_count as u64 + 1;
+    scene
+}
+
 #[cfg(test)]
 mod tests {
     use crate::scene::{
@@ -287,4 +457,49 @@ mod tests {
         assert!(entry.binding.wrap_repeat_u);
         assert!(!entry.binding.wrap_repeat_v);
     }
+
+    #[test]
+    fn test_binary_scene_file_roundtrip_and_convert() {
+        let mut scene = SceneState::new();
+        scene.add_object(SceneObject {
+            id: 1,
+            name: "Light".to_string(),
+            kind: SceneObjectKind::DirectionalLight(crate::scene::DirectionalLightData {
+                color: [1.0, 1.0, 1.0],
+                intensity: 100_000.0,
+                direction: [0.0, -1.0, -0.5],
+            }),
+        });
+        scene.add_object(SceneObject {
+            id: 2,
+            name: "Helmet".to_string(),
+            kind: SceneObjectKind::Asset(AssetData {
+                path: "assets/gltf/DamagedHelmet.gltf".to_string(),
+                position: [1.0, 2.0, 3.0],
+                rotation_deg: [10.0, 20.0, 30.0],
+                scale: [1.0, 1.0, 1.0],
+            }),
+        });
+
+        let dir = std::env::temp_dir().join(format!("previz_binary_scene_{}", std::process::id()));
+        std::fs::create_dir_all(&dir).unwrap();
+        let json_path = dir.join("scene.json");
+        let binary_path = dir.join(format!("scene.{}", super::BINARY_SCENE_EXTENSION));
+        let back_path = dir.join("back.json");
+        super::save_scene_to_file(&scene, &json_path).unwrap();
+        super::convert_scene_file(&json_path, &binary_path).unwrap();
+        super::convert_scene_file(&binary_path, &back_path).unwrap();
+        let original = std::fs::read_to_string(&json_path).unwrap();
+        let converted = std::fs::read_to_string(&back_path).unwrap();
+
+        // Loading the binary file migrates like JSON does.
+        let loaded = super::load_scene_from_file(&binary_path).unwrap();
+        let _ = std::fs::remove_dir_all(&dir);
+        assert_eq!(original, converted);
+        assert_eq!(loaded.objects().len(), 2);
+        assert!(matches!(
+            loaded.objects()[0].kind,
+            SceneObjectKind::Light(_)
+        ));
+    }
 }
@@ -49,6 +49,7 @@ pub struct UiState {
     environment_skybox_path: [u8; 260],
     environment_intensity: f32,
     environment_status: String,
+    material_warmup_progress: Option<(u32, u32)>,
 }
 
 #[derive(Debug, Clone, Copy)]
@@ -123,6 +124,7 @@ impl UiState {
             environment_skybox_path: [0u8; 260],
             environment_intensity: 30_000.0,
             environment_status: String::new(),
+            material_warmup_progress: None,
         }
     }
 
@@ -130,7 +132,7 @@ impl UiState {
         if self.show_asset_panel {
             let mut summary = String::new();
             for (index, object) in scene.objects().iter().enumerate() {
-                let runtime_object = runtime.get(index).copied().unwrap_or_default();
+                let runtime_object = runtime.get(index).unwrap_or_default();
                 summary.push_str(&format!(
                     "{} (center {:.2}, {:.2}, {:.2}, extent {:.2}, {:.2}, {:.2})\n",
                     object.name,
@@ -143,6 +145,16 @@ impl UiState {
                 ));
             }
             summary.push_str(&format!("Loaded assets: {}", assets.loaded_assets().len()));
+            if let Some((pending, progress)) = assets.load_progress() {
+                summary.push_str(&format!(
+                    "\nLoading assets: {} ({:.0}%)",
+                    pending,
+                    progress * 100.0
+                ));
+            }
+            if let Some((compiled, total)) = self.material_warmup_progress {
+                summary.push_str(&format!("\nCompiling materials: {}/{}", compiled, total));
+            }
             if !self.environment_status.is_empty() {
                 summary.push_str("\n");
                 summary.push_str(&self.environment_status);
@@ -232,4 +244,9 @@ impl UiState {
     pub fn set_environment_status(&mut self, status: String) {
         self.environment_status = status;
     }
+
+    /// `(compiled, total)` for the material warm-up in flight, if any.
+    pub fn set_material_warmup_progress(&mut self, progress: Option<(u32, u32)>) {
+        self.material_warmup_progress = progress;
+    }
 }